@@ -0,0 +1,214 @@
+/***********************************************************************
+ *  File Name   : batch.c
+ *  Description : Non-interactive batch mode for the Red-Black Tree.
+ *                Reads the command stream in BATCH_BUF_SIZE chunks,
+ *                parses it by hand (no scanf per op), applies the ops
+ *                back to back on a pooled tree and prints one summary
+ *                with the elapsed time.
+ *
+ *  Functions:
+ *      - apply_op()
+ *      - parse_text()
+ *      - parse_binary()
+ *      - run_batch()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <string.h>
+#include <time.h>
+#include "batch.h"
+
+/* --------------------------------------------------------------------
+ * Helper Function: apply_op()
+ * Description: Runs one operation and tallies its result.
+ * --------------------------------------------------------------------*/
+static void apply_op(char op, int data, Tree **root, NodePool *pool, BatchSummary *sum)
+{
+    switch (op)
+    {
+        case 'I':
+            if (insert_node_pool(root, data, pool) == SUCCESS)
+                sum->inserted++;
+            else
+                sum->duplicates++;
+            break;
+
+        case 'S':
+            if (search_node(*root, data) == SUCCESS)
+                sum->found++;
+            else
+                sum->missing++;
+            break;
+
+        case 'D':
+            if (delete_node_pool(root, data, pool) == SUCCESS)
+                sum->deleted++;
+            else
+                sum->not_deleted++;
+            break;
+
+        default:
+            sum->errors++;
+            break;
+    }
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: parse_text()
+ * Description: Parses the complete lines in buf[0, len) and returns
+ *              how many bytes were consumed; a trailing partial line
+ *              is left for the next chunk unless @last is set.
+ * --------------------------------------------------------------------*/
+static size_t parse_text(const char *buf, size_t len, int last,
+                         Tree **root, NodePool *pool, BatchSummary *sum)
+{
+    size_t pos = 0;
+
+    while (pos < len)
+    {
+        const char *end = memchr(buf + pos, '\n', len - pos);
+        if (end == NULL && !last)
+            break;
+
+        size_t stop = end ? (size_t)(end - buf) : len, i = pos;
+        while (i < stop && (buf[i] == ' ' || buf[i] == '\t' || buf[i] == '\r'))
+            i++;
+
+        if (i < stop && buf[i] != '#')
+        {
+            char op = buf[i++];
+            long value = 0;
+            int negative = 0, digits = 0;
+
+            while (i < stop && (buf[i] == ' ' || buf[i] == '\t'))
+                i++;
+            if (i < stop && (buf[i] == '-' || buf[i] == '+'))
+                negative = (buf[i++] == '-');
+            while (i < stop && buf[i] >= '0' && buf[i] <= '9')
+            {
+                if (value <= 2147483648L)   // past it the value only matters as too big
+                    value = value * 10 + (buf[i] - '0');
+                i++;
+                digits++;
+            }
+            if (negative)
+                value = -value;
+
+            // The number must end the token: "5abc" is corrupt, not 5
+            int ended = (i == stop || buf[i] == ' ' || buf[i] == '\t' || buf[i] == '\r');
+            if (digits == 0 || !ended || value < -2147483648L || value > 2147483647L)
+                sum->errors++;
+            else
+                apply_op(op, (int)value, root, pool, sum);
+        }
+        pos = stop + 1;
+    }
+    return pos < len ? pos : len;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: parse_binary()
+ * Description: Applies the whole records in buf[0, len) and returns
+ *              how many bytes were consumed.
+ * --------------------------------------------------------------------*/
+static size_t parse_binary(const unsigned char *buf, size_t len,
+                           Tree **root, NodePool *pool, BatchSummary *sum)
+{
+    size_t pos = 0;
+
+    for (; pos + BATCH_RECORD <= len; pos += BATCH_RECORD)
+    {
+        unsigned int raw = (unsigned int)buf[pos + 1] |
+                           (unsigned int)buf[pos + 2] << 8 |
+                           (unsigned int)buf[pos + 3] << 16 |
+                           (unsigned int)buf[pos + 4] << 24;
+        apply_op((char)buf[pos], (int)raw, root, pool, sum);
+    }
+    return pos;
+}
+
+/* --------------------------------------------------------------------
+ * Function: run_batch()
+ * Description: Replays every op in @in (text or binary, detected from
+ *              the first bytes) and prints a summary with timing. A
+ *              text line longer than BATCH_BUF_SIZE counts as one error
+ *              and is skipped whole, up to its newline.
+ * --------------------------------------------------------------------*/
+int run_batch(FILE *in)
+{
+    char *buf = malloc(BATCH_BUF_SIZE);
+    if (buf == NULL)
+        return FAILURE;
+
+    Tree *root = NULL;
+    NodePool pool;
+    BatchSummary sum = { 0 };
+    size_t len = 0, magic = strlen(BATCH_MAGIC);
+    int binary = -1, eof = 0, skip = 0;
+    struct timespec t0, t1;
+
+    pool_init(&pool, 0);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    while (!eof || len > 0)
+    {
+        if (!eof)
+        {
+            size_t got = fread(buf + len, 1, BATCH_BUF_SIZE - len, in);
+            len += got;
+            eof = (got == 0);
+        }
+
+        if (binary < 0)
+        {
+            if (len < magic && !eof)
+                continue;
+            binary = (len >= magic && memcmp(buf, BATCH_MAGIC, magic) == 0);
+            if (binary)
+                memmove(buf, buf + magic, len -= magic);
+        }
+
+        // Rest of a dropped over-long line: discard it through its newline
+        if (skip)
+        {
+            char *nl = memchr(buf, '\n', len);
+            size_t drop = nl ? (size_t)(nl - buf) + 1 : len;
+
+            skip = (nl == NULL);
+            memmove(buf, buf + drop, len -= drop);
+            continue;
+        }
+
+        size_t used = binary
+            ? parse_binary((unsigned char *)buf, len, &root, &pool, &sum)
+            : parse_text(buf, len, eof, &root, &pool, &sum);
+
+        if (used == 0 && len > 0 && (eof || len == BATCH_BUF_SIZE))
+        {
+            sum.errors++;   // truncated record or over-long line
+            used = len;
+            skip = !binary && !eof;
+        }
+        memmove(buf, buf + used, len - used);
+        len -= used;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double seconds = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+    unsigned long ops = sum.inserted + sum.duplicates + sum.found + sum.missing +
+                        sum.deleted + sum.not_deleted;
+
+    printf("ops        : %lu (%s input)\n", ops, binary == 1 ? "binary" : "text");
+    printf("insert     : %lu inserted, %lu duplicate\n", sum.inserted, sum.duplicates);
+    printf("search     : %lu found, %lu missing\n", sum.found, sum.missing);
+    printf("delete     : %lu deleted, %lu not found\n", sum.deleted, sum.not_deleted);
+    printf("errors     : %lu\n", sum.errors);
+    printf("time       : %.6f s (%.0f ops/s)\n", seconds, seconds > 0 ? (double)ops / seconds : 0.0);
+
+    pool_destroy(&pool, &root);
+    free(buf);
+    return sum.errors ? FAILURE : SUCCESS;
+}
@@ -0,0 +1,48 @@
+/***********************************************************************
+ *  File Name   : batch.h
+ *  Description : Header file for the non-interactive batch mode.
+ *                Replays a stream of tree operations read from a file
+ *                or stdin and prints only a summary.
+ *
+ *                Text format  : one op per line, "I <n>", "S <n>" or
+ *                               "D <n>" (insert/search/delete); blank
+ *                               lines and lines starting with '#' are
+ *                               skipped.
+ *                Binary format: the 4-byte magic "RBOP" followed by
+ *                               5-byte records: op byte ('I'/'S'/'D')
+ *                               and a little-endian 32-bit key.
+ *
+ *  Functions:
+ *                - run_batch() : Replay a command stream
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "tree.h"
+
+/*--------------------------------------------------------------
+ *                      BATCH MACROS
+ *-------------------------------------------------------------*/
+#define BATCH_BUF_SIZE (1 << 20)   // bytes per read() from the input
+#define BATCH_MAGIC "RBOP"         // binary op log signature
+#define BATCH_RECORD 5             // op byte + 32-bit key
+
+/**
+ * struct BatchSummary - Outcome counts of a replayed stream
+ */
+typedef struct BatchSummary
+{
+    unsigned long inserted, duplicates;
+    unsigned long found, missing;
+    unsigned long deleted, not_deleted;
+    unsigned long errors;
+} BatchSummary;
+
+int run_batch(FILE *in);
+
+#endif /* BATCH_H */
@@ -0,0 +1,469 @@
+/***********************************************************************
+ *  File Name   : bench.c
+ *  Description : Reproducible benchmark driver for the Red-Black Tree.
+ *                Runs insert_node(), search_node(), delete_node() and
+ *                delete_tree() under several workloads and tree sizes
+ *                and reports throughput, latency percentiles and peak
+ *                memory.
+ *
+ *                Built with FEATURES=-DRB_STATS, each row also carries
+ *                the hot-path counters of the timed section.
+ *
+ *                Every (workload, size) run happens in a forked child,
+ *                so its peak RSS is measured in isolation. Results go to
+ *                stdout as CSV (one row per run); progress goes to stderr.
+ *
+ *  Usage       : rbtree_bench [max_size] [seed]
+ *                Sizes run from 1e3 up to max_size (default 1e6) in
+ *                powers of ten, e.g. rbtree_bench 100000000.
+ *
+ *  Workloads   :
+ *                - seq_insert     : insert keys 0..n-1 in order
+ *                - rand_insert    : insert n distinct scrambled keys
+ *                - rand_search    : uniform lookups of present keys
+ *                - zipf_search    : Zipfian (theta 0.99) lookups
+ *                - mixed_90_10    : 90% lookups, 10% inserts/deletes
+ *                - mixed_50_50    : 50% lookups, 50% inserts/deletes
+ *                - rand_delete    : delete every key in scrambled order
+ *                - delete_tree    : tear down the whole tree (per node)
+ *                - delete_tree_recursive : the same, freeing by post-order
+ *                                   recursion (the former delete_tree())
+ *                - range_scan     : cursor steps, reseeking a random key
+ *                                   every SCAN_LEN steps
+ *                - inorder_visit  : sum every key through visit_tree()
+ *                - inorder_batch  : the same through next_batch()
+ *                - inorder_recursive : the same by recursion
+ *                - td_rand_insert, td_mixed_50_50, td_rand_delete
+ *                                 : the same with the top-down variants
+ *                - lazy_rand_delete : rand_delete through
+ *                                   rbtree_lazy_delete() (RB_LAZY_DELETE)
+ *                - gen_rand_insert, gen_rand_delete
+ *                                 : rand_insert and rand_delete on the
+ *                                   tree_gen.h instantiation gen_int
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "../tree.h"
+#include "../tree_gen.h"
+
+/*--------------------------------------------------------------
+ *                      BENCHMARK MACROS
+ *-------------------------------------------------------------*/
+#define MIN_SIZE 1000
+#define DEFAULT_MAX_SIZE 1000000
+#define DEFAULT_SEED 42
+#define LAT_SAMPLES 1000000    // per-op latencies kept per run
+#define ZIPF_THETA 0.99
+
+/* Scrambles 0..n-1 into distinct keys spread over the int range */
+#define KEY(i) scramble((unsigned int)(i))
+#define SCAN_LEN 1000          // cursor steps per range_scan seek
+#define BATCH_LEN 256          // keys per next_batch() call in inorder_batch
+
+/**
+ * struct Bench - State of one benchmark run
+ * @rng     : xorshift64* state
+ * @lat     : Sampled per-op latencies in nanoseconds
+ * @nlat    : Number of samples in @lat
+ * @stride  : Every @stride-th op is timed individually
+ */
+typedef struct Bench
+{
+    unsigned long long rng;
+    long *lat;
+    size_t nlat;
+    size_t stride;
+} Bench;
+
+/**
+ * struct Zipf - Gray et al. Zipfian generator over ranks 0..n-1
+ */
+typedef struct Zipf
+{
+    double theta, alpha, zetan, eta;
+    size_t n;
+} Zipf;
+
+/* --------------------------------------------------------------------
+ * Helper Function: scramble()
+ * Description: 32-bit integer finalizer (a bijection), so distinct
+ *              indices give distinct, randomly ordered keys.
+ * --------------------------------------------------------------------*/
+static int scramble(unsigned int x)
+{
+    x ^= x >> 16;
+    x *= 0x85ebca6bu;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35u;
+    x ^= x >> 16;
+    return (int)x;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: now_ns()
+ * Description: Monotonic clock in nanoseconds.
+ * --------------------------------------------------------------------*/
+static long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: next_rand()
+ * Description: xorshift64* generator; fixed seed => same op stream.
+ * --------------------------------------------------------------------*/
+static unsigned long long next_rand(Bench *b)
+{
+    b->rng ^= b->rng >> 12;
+    b->rng ^= b->rng << 25;
+    b->rng ^= b->rng >> 27;
+    return b->rng * 2685821657736338717ULL;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: zipf_init() / zipf_next()
+ * Description: Zipfian ranks in O(1) each after an O(n) setup.
+ * --------------------------------------------------------------------*/
+static void zipf_init(Zipf *z, size_t n, double theta)
+{
+    z->n = n;
+    z->theta = theta;
+    z->zetan = 0;
+    for (size_t i = 1; i <= n; i++)
+        z->zetan += 1.0 / pow((double)i, theta);
+
+    double zeta2 = 1.0 + 1.0 / pow(2.0, theta);
+    z->alpha = 1.0 / (1.0 - theta);
+    z->eta = (1.0 - pow(2.0 / (double)n, 1.0 - theta)) / (1.0 - zeta2 / z->zetan);
+}
+
+static size_t zipf_next(Zipf *z, Bench *b)
+{
+    double u = (double)(next_rand(b) >> 11) / 9007199254740992.0;
+    double uz = u * z->zetan;
+
+    if (uz < 1.0)
+        return 0;
+    if (uz < 1.0 + pow(0.5, z->theta))
+        return 1;
+
+    size_t rank = (size_t)((double)z->n * pow(z->eta * u - z->eta + 1.0, z->alpha));
+    return rank < z->n ? rank : z->n - 1;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: compare_long()
+ * Description: qsort() comparator for latency samples.
+ * --------------------------------------------------------------------*/
+static int compare_long(const void *a, const void *b)
+{
+    long x = *(const long *)a, y = *(const long *)b;
+    return (x > y) - (x < y);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: percentile()
+ * Description: Returns the p-th percentile of the sorted samples.
+ * --------------------------------------------------------------------*/
+static long percentile(const Bench *b, double p)
+{
+    if (b->nlat == 0)
+        return 0;
+    size_t idx = (size_t)(p / 100.0 * (double)(b->nlat - 1) + 0.5);
+    return b->lat[idx];
+}
+
+/* Runs one operation, timing it individually on sampled iterations */
+#define TIMED_OP(b, i, op)                                  \
+    do {                                                    \
+        if ((i) % (b)->stride == 0 && (b)->nlat < LAT_SAMPLES) \
+        {                                                   \
+            long t0_ = now_ns();                            \
+            op;                                             \
+            (b)->lat[(b)->nlat++] = now_ns() - t0_;         \
+        }                                                   \
+        else                                                \
+            op;                                             \
+    } while (0)
+
+/* --------------------------------------------------------------------
+ * Helper Function: build_random()
+ * Description: Untimed setup: a tree holding KEY(0..n-1).
+ * --------------------------------------------------------------------*/
+static Tree *build_random(size_t n)
+{
+    Tree *root = NULL;
+    for (size_t i = 0; i < n; i++)
+        insert_node(&root, KEY(i));
+    return root;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: mixed_ops()
+ * Description: @read_pct% lookups of present keys; the rest insert or
+ *              delete keys drawn from 0..2n-1, keeping the size near n.
+ *              @topdown selects the single-pass insert/delete.
+ * --------------------------------------------------------------------*/
+static void mixed_ops(Bench *b, Tree **root, size_t n, unsigned read_pct, int topdown)
+{
+    int (*insert)(Tree **, int) = topdown ? insert_node_topdown : insert_node;
+    int (*delete)(Tree **, int) = topdown ? delete_node_topdown : delete_node;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        unsigned long long r = next_rand(b);
+        size_t j = (size_t)((r >> 8) % (2 * n));
+
+        if (r % 100 < read_pct)
+            TIMED_OP(b, i, search_node(*root, KEY(j % n)));
+        else if ((r >> 7) & 1)
+            TIMED_OP(b, i, insert(root, KEY(j)));
+        else
+            TIMED_OP(b, i, delete(root, KEY(j)));
+    }
+}
+
+/* int -> int tree generated from tree_gen.h, for the gen_* workloads */
+RBTREE_PROTOTYPE_STATIC(gen_int, int, int)
+RBTREE_GENERATE_STATIC(gen_int, int, int, RBTREE_INT_CMP)
+
+/* Keeps the in-order sums observable so they are not optimized away */
+static volatile long long sink;
+
+/* --------------------------------------------------------------------
+ * Helper Function: sum_visit()
+ * Description: visit_tree() callback adding each key to *arg.
+ * --------------------------------------------------------------------*/
+static int sum_visit(Tree *node, void *arg)
+{
+    *(long long *)arg += node->data;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: sum_batches()
+ * Description: Sums every key, BATCH_LEN at a time via next_batch().
+ * --------------------------------------------------------------------*/
+static long long sum_batches(Tree *root)
+{
+    int keys[BATCH_LEN];
+    long long sum = 0;
+    size_t got;
+    Tree *cursor = seek_node(root, INT_MIN);
+
+    while ((got = next_batch(&cursor, keys, BATCH_LEN)) > 0)
+        for (size_t i = 0; i < got; i++)
+            sum += keys[i];
+    return sum;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: sum_recursive()
+ * Description: Recursive in-order sum, the baseline for the visitors.
+ * --------------------------------------------------------------------*/
+static long long sum_recursive(Tree *node)
+{
+    return node ? sum_recursive(node->left) + node->data + sum_recursive(node->right) : 0;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: free_recursive()
+ * Description: Post-order recursive teardown, the baseline for
+ *              delete_tree().
+ * --------------------------------------------------------------------*/
+static void free_recursive(Tree *node)
+{
+    if (node == NULL)
+        return;
+    free_recursive(node->left);
+    free_recursive(node->right);
+    pool_free(NULL, node);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: run_workload()
+ * Description: Performs one workload of @n ops and prints its CSV row.
+ *              Runs inside a forked child.
+ * --------------------------------------------------------------------*/
+static void run_workload(const char *name, size_t n, unsigned long long seed)
+{
+    Bench b = { seed ? seed : 1, NULL, 0, n / LAT_SAMPLES + 1 };
+    Tree *root = NULL;
+    gen_int_node *gen = NULL;
+    RBTree lazy;
+    Zipf zipf;
+    long start = 0, elapsed;
+
+    b.lat = malloc(LAT_SAMPLES * sizeof(long));
+    if (b.lat == NULL)
+        exit(EXIT_FAILURE);
+
+    // Untimed setup
+    rbtree_init(&lazy, NULL);
+    if (strcmp(name, "lazy_rand_delete") == 0)
+        for (size_t i = 0; i < n; i++)
+            rbtree_insert(&lazy, KEY(i), NULL);
+    else if (strcmp(name, "gen_rand_delete") == 0)
+        for (size_t i = 0; i < n; i++)
+            gen_int_insert(&gen, KEY(i), (int)i);
+    else if (strcmp(name, "gen_rand_insert") && strcmp(name, "seq_insert") && strcmp(name, "rand_insert") &&
+             strcmp(name, "td_rand_insert"))
+        root = build_random(n);
+    if (strcmp(name, "zipf_search") == 0)
+        zipf_init(&zipf, n, ZIPF_THETA);
+
+    reset_stats();
+    start = now_ns();
+    if (strcmp(name, "seq_insert") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, insert_node(&root, (int)i));
+    else if (strcmp(name, "rand_insert") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, insert_node(&root, KEY(i)));
+    else if (strcmp(name, "rand_search") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, search_node(root, KEY(next_rand(&b) % n)));
+    else if (strcmp(name, "zipf_search") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, search_node(root, KEY(zipf_next(&zipf, &b))));
+    else if (strcmp(name, "mixed_90_10") == 0)
+        mixed_ops(&b, &root, n, 90, 0);
+    else if (strcmp(name, "mixed_50_50") == 0)
+        mixed_ops(&b, &root, n, 50, 0);
+    else if (strcmp(name, "rand_delete") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, delete_node(&root, KEY((i * 7919) % n)));
+    else if (strcmp(name, "td_rand_insert") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, insert_node_topdown(&root, KEY(i)));
+    else if (strcmp(name, "td_mixed_50_50") == 0)
+        mixed_ops(&b, &root, n, 50, 1);
+    else if (strcmp(name, "td_rand_delete") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, delete_node_topdown(&root, KEY((i * 7919) % n)));
+#ifdef RB_LAZY_DELETE
+    else if (strcmp(name, "lazy_rand_delete") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, rbtree_lazy_delete(&lazy, KEY((i * 7919) % n)));
+#endif
+    else if (strcmp(name, "gen_rand_insert") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, gen_int_insert(&gen, KEY(i), (int)i));
+    else if (strcmp(name, "gen_rand_delete") == 0)
+        for (size_t i = 0; i < n; i++)
+            TIMED_OP(&b, i, gen_int_delete(&gen, KEY((i * 7919) % n)));
+    else if (strcmp(name, "delete_tree") == 0)
+        TIMED_OP(&b, 0, delete_tree(&root));
+    else if (strcmp(name, "delete_tree_recursive") == 0)
+    {
+        TIMED_OP(&b, 0, free_recursive(root));
+        root = NULL;
+    }
+    else if (strcmp(name, "inorder_visit") == 0)
+    {
+        long long sum = 0;
+        TIMED_OP(&b, 0, visit_tree(root, sum_visit, &sum));
+        sink = sum;
+    }
+    else if (strcmp(name, "inorder_batch") == 0)
+        TIMED_OP(&b, 0, sink = sum_batches(root));
+    else if (strcmp(name, "inorder_recursive") == 0)
+        TIMED_OP(&b, 0, sink = sum_recursive(root));
+    else if (strcmp(name, "range_scan") == 0)
+    {
+        Tree *cursor = NULL;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (i % SCAN_LEN == 0 || cursor == NULL)
+                TIMED_OP(&b, i, cursor = seek_node(root, KEY(next_rand(&b) % n)));
+            else
+                TIMED_OP(&b, i, cursor = next_node(cursor));
+        }
+    }
+    elapsed = now_ns() - start;
+
+    RBStats stats;
+    get_stats(&stats);
+    delete_tree(&root);
+    gen_int_destroy(&gen);
+    rbtree_destroy(&lazy);
+    qsort(b.lat, b.nlat, sizeof(long), compare_long);
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    double seconds = (double)elapsed / 1e9;
+    printf("%s,%zu,%zu,%.6f,%.0f,%ld,%ld,%ld,%ld",
+           name, n, n, seconds, seconds > 0 ? (double)n / seconds : 0.0,
+           percentile(&b, 50), percentile(&b, 99), percentile(&b, 99.9),
+           usage.ru_maxrss);
+#ifdef RB_STATS
+    printf(",%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+           stats.left_rotations + stats.right_rotations, stats.recolors,
+           stats.insert_fixups, stats.double_black, stats.double_black_max,
+           stats.comparisons, stats.node_allocs, stats.node_frees);
+#else
+    printf("\n");
+    (void)stats;
+#endif
+    fflush(stdout);
+    free(b.lat);
+}
+
+int main(int argc, char *argv[])
+{
+    static const char *workloads[] = {
+        "seq_insert", "rand_insert", "rand_search", "zipf_search",
+        "mixed_90_10", "mixed_50_50", "rand_delete", "delete_tree", "range_scan",
+        "delete_tree_recursive", "inorder_visit", "inorder_batch", "inorder_recursive",
+        "td_rand_insert", "td_mixed_50_50", "td_rand_delete",
+        "gen_rand_insert", "gen_rand_delete",
+#ifdef RB_LAZY_DELETE
+        "lazy_rand_delete",
+#endif
+    };
+    size_t max_size = (argc > 1) ? strtoull(argv[1], NULL, 10) : DEFAULT_MAX_SIZE;
+    unsigned long long seed = (argc > 2) ? strtoull(argv[2], NULL, 10) : DEFAULT_SEED;
+
+    printf("workload,size,ops,seconds,ops_per_sec,p50_ns,p99_ns,p999_ns,peak_rss_kb");
+#ifdef RB_STATS
+    printf(",rotations,recolors,insert_fixups,double_black,double_black_max,"
+           "comparisons,node_allocs,node_frees");
+#endif
+    printf("\n");
+    fflush(stdout);
+
+    // 7919 (used by rand_delete) must not divide the size
+    for (size_t n = MIN_SIZE; n <= max_size; n *= 10)
+    {
+        for (size_t w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++)
+        {
+            fprintf(stderr, "running %-12s n=%zu\n", workloads[w], n);
+
+            pid_t pid = fork();
+            if (pid == 0)
+            {
+                run_workload(workloads[w], n, seed);
+                exit(EXIT_SUCCESS);
+            }
+
+            int status;
+            if (pid < 0 || waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) ||
+                WEXITSTATUS(status) != EXIT_SUCCESS)
+                fprintf(stderr, "  %s n=%zu failed\n", workloads[w], n);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,244 @@
+/***********************************************************************
+ *  File Name   : bulk.c
+ *  Description : Bulk loading for the Red-Black Tree.
+ *                Builds a valid Red-Black Tree directly from sorted keys
+ *                in O(n), coloring nodes by depth instead of inserting
+ *                them one at a time (no insert_node() or rotations),
+ *                and inserts unsorted batches of keys in sorted order
+ *                using the previous insert point as a search finger.
+ *
+ *  Functions:
+ *      - build_range()
+ *      - release_subtree()
+ *      - build_from_sorted()
+ *      - build_from_sorted_pool()
+ *      - compare_entries()
+ *      - finger_start()
+ *      - insert_batch()
+ *      - insert_batch_pool()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "tree.h"
+
+/* --------------------------------------------------------------------
+ * Helper Function: release_subtree()
+ * Description: Returns every node of a (partially built) subtree to
+ *              @pool, or frees them when @pool is NULL.
+ * --------------------------------------------------------------------*/
+static void release_subtree(Tree *node, NodePool *pool)
+{
+    if (node == NULL)
+        return;
+
+    release_subtree(node->left, pool);
+    release_subtree(node->right, pool);
+    pool_free(pool, node);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: build_range()
+ * Description: Builds a perfectly balanced subtree from keys[lo, hi).
+ *              Every level above @red_depth is complete, so making the
+ *              nodes on that last, partial level RED keeps the black
+ *              height equal on every path.
+ * --------------------------------------------------------------------*/
+static Tree *build_range(const int *keys, size_t lo, size_t hi, int depth,
+                         int red_depth, Tree *parent, NodePool *pool, int *status)
+{
+    if (lo >= hi)
+        return NULL;
+
+    size_t mid = lo + (hi - lo) / 2;
+    Tree *node = create_node_pool(keys[mid], pool);
+    if (node == NULL)
+    {
+        *status = FAILURE;
+        return NULL;
+    }
+
+    SET_PARENT(node, parent);
+    SET_COLOR(node, (depth == red_depth) ? RED : BLACK);
+#ifdef RB_ORDER_STATS
+    node->size = (unsigned int)(hi - lo);
+#endif
+    node->left = build_range(keys, lo, mid, depth + 1, red_depth, node, pool, status);
+    node->right = build_range(keys, mid + 1, hi, depth + 1, red_depth, node, pool, status);
+
+    if (*status != SUCCESS)
+    {
+        release_subtree(node, pool);
+        return NULL;
+    }
+    return node;
+}
+
+/* --------------------------------------------------------------------
+ * Function: build_from_sorted()
+ * Description: Builds a Red-Black Tree from @n strictly ascending keys
+ *              in O(n). Returns NULL if @n is 0, the keys are not
+ *              strictly ascending, or memory runs out.
+ * --------------------------------------------------------------------*/
+Tree *build_from_sorted(const int *keys, size_t n)
+{
+    return build_from_sorted_pool(keys, n, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: build_from_sorted_pool()
+ * Description: Same as build_from_sorted(), taking nodes from @pool.
+ * --------------------------------------------------------------------*/
+Tree *build_from_sorted_pool(const int *keys, size_t n, NodePool *pool)
+{
+    if (keys == NULL || n == 0)
+        return NULL;
+
+    for (size_t i = 1; i < n; i++)
+        if (keys[i - 1] >= keys[i])
+            return NULL;   // duplicates or unsorted input
+
+    // Levels 0 .. red_depth-1 are full; red_depth = floor(log2(n + 1))
+    int red_depth = 0;
+    for (size_t full = n + 1; full > 1; full >>= 1)
+        red_depth++;
+
+    int status = SUCCESS;
+    Tree *root = build_range(keys, 0, n, 0, red_depth, NULL, pool, &status);
+#ifdef RB_THREADED
+    thread_tree(root);
+#endif
+    return root;
+}
+
+/**
+ * struct BatchEntry - A batch key paired with its position in the input
+ * @key   : Key to insert
+ * @index : Index of @key in the caller's array (where its status goes)
+ */
+typedef struct BatchEntry
+{
+    int key;
+    size_t index;
+} BatchEntry;
+
+/* --------------------------------------------------------------------
+ * Helper Function: compare_entries()
+ * Description: qsort() comparator ordering entries by key, then by
+ *              input position so the first occurrence of a key wins.
+ * --------------------------------------------------------------------*/
+static int compare_entries(const void *a, const void *b)
+{
+    const BatchEntry *x = a, *y = b;
+
+    if (x->key != y->key)
+        return (x->key < y->key) ? -1 : 1;
+    return (x->index < y->index) ? -1 : (x->index > y->index);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: finger_start()
+ * Description: Climbs from @finger (holding a key smaller than @data)
+ *              to the lowest ancestor whose subtree can contain @data.
+ *              Consecutive keys therefore skip the shared upper path.
+ * --------------------------------------------------------------------*/
+static Tree *finger_start(Tree *finger, int data)
+{
+    while (NODE_PARENT(finger))
+    {
+        if (finger == NODE_PARENT(finger)->left && data < NODE_PARENT(finger)->data)
+            break;
+        finger = NODE_PARENT(finger);
+    }
+    return finger;
+}
+
+/* --------------------------------------------------------------------
+ * Function: insert_batch()
+ * Description: Inserts @n keys in one sorted pass. @status (optional)
+ *              receives SUCCESS, DUPLICATE or FAILURE for each key, in
+ *              the caller's order. Returns FAILURE if memory ran out.
+ * --------------------------------------------------------------------*/
+int insert_batch(Tree **root, int *keys, size_t n, int *status)
+{
+    return insert_batch_pool(root, keys, n, status, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: insert_batch_pool()
+ * Description: Same as insert_batch(), taking nodes from @pool.
+ * --------------------------------------------------------------------*/
+int insert_batch_pool(Tree **root, int *keys, size_t n, int *status, NodePool *pool)
+{
+    if (n == 0)
+        return SUCCESS;
+    if (keys == NULL)
+        return FAILURE;
+
+    BatchEntry *batch = malloc(n * sizeof(BatchEntry));
+    if (batch == NULL)
+        return FAILURE;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        batch[i].key = keys[i];
+        batch[i].index = i;
+    }
+    qsort(batch, n, sizeof(BatchEntry), compare_entries);
+
+    Tree *finger = NULL;
+    int result = SUCCESS;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        int data = batch[i].key, flag = SUCCESS;
+
+        // Descend from the finger's ancestor instead of from *root
+        Tree *temp = finger ? finger_start(finger, data) : *root, *prev = NULL;
+        while (temp)
+        {
+            STAT_INC(comparisons);
+            prev = temp;
+            if (data < temp->data)
+                temp = temp->left;
+            else if (data > temp->data)
+                temp = temp->right;
+            else
+                break;
+        }
+
+        if (temp)
+        {
+            flag = DUPLICATE;
+            finger = temp;
+        }
+        else if (result == FAILURE || (temp = create_node_pool(data, pool)) == NULL)
+        {
+            flag = result = FAILURE;
+        }
+        else
+        {
+            SET_PARENT(temp, prev);
+            if (prev == NULL)
+                *root = temp;
+            else if (data < prev->data)
+                prev->left = temp;
+            else
+                prev->right = temp;
+            SIZE_PATH_INC(prev);
+            if (prev)
+                THREAD_ATTACH(temp, prev, data > prev->data);
+
+            insert_fixup(root, temp);
+            finger = temp;
+        }
+
+        if (status)
+            status[batch[i].index] = flag;
+    }
+
+    free(batch);
+    return result;
+}
@@ -0,0 +1,199 @@
+/***********************************************************************
+ *  File Name   : compact.c
+ *  Description : Locality-restoring compaction for the Red-Black Tree.
+ *                After long churn the nodes are scattered over the heap;
+ *                compaction copies them, in BFS order, into one slab so
+ *                the top levels share cache lines and a search walks
+ *                forward through memory. The relocated nodes themselves
+ *                serve as the BFS queue, so no extra memory is needed.
+ *
+ *                Between compact_step() calls the tree may be searched
+ *                and iterated, but must not be modified: finish the
+ *                compaction first.
+ *
+ *  Functions:
+ *      - count_nodes()
+ *      - relocate()
+ *      - compact_begin()
+ *      - compact_step()
+ *      - compact_tree()
+ *      - rbtree_compact_begin()
+ *      - rbtree_compact()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "compact.h"
+
+/* --------------------------------------------------------------------
+ * Helper Function: count_nodes()
+ * Description: Returns the number of nodes in a subtree.
+ * --------------------------------------------------------------------*/
+static size_t count_nodes(Tree *node)
+{
+#ifdef RB_ORDER_STATS
+    return NODE_SIZE(node);
+#else
+    return node ? 1 + count_nodes(node->left) + count_nodes(node->right) : 0;
+#endif
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: relocate()
+ * Description: Copies @old into the next slot of the block and points
+ *              every neighbour (parent, children and, with RB_THREADED,
+ *              in-order links, and an RBTree's cached extremes) at the
+ *              copy, then releases @old.
+ * --------------------------------------------------------------------*/
+static void relocate(Compactor *c, Tree *old)
+{
+    Tree *node = pool_alloc(c->pool);
+    Tree *parent = NODE_PARENT(old);
+
+    *node = *old;
+    if (parent == NULL)
+        *c->root = node;
+    else if (parent->left == old)
+        parent->left = node;
+    else
+        parent->right = node;
+
+    if (node->left)
+        SET_PARENT(node->left, node);
+    if (node->right)
+        SET_PARENT(node->right, node);
+#ifdef RB_THREADED
+    if (node->prev)
+        node->prev->next = node;
+    if (node->next)
+        node->next->prev = node;
+#endif
+    if (c->tree && c->tree->min == old)
+        c->tree->min = node;
+    if (c->tree && c->tree->max == old)
+        c->tree->max = node;
+
+    pool_free(c->old_pool, old);
+    c->moved++;
+}
+
+/* --------------------------------------------------------------------
+ * Function: compact_begin()
+ * Description: Sets up compaction of *root into @pool, which must not
+ *              be initialized yet: it gets a single slab sized for the
+ *              whole tree. Old nodes are returned to @old_pool (NULL
+ *              for malloc'd trees); destroy that pool once done.
+ *              Every node is relocated, so all Tree * handles into the
+ *              tree become invalid; for an RBTree, whose min/max are
+ *              such handles, use rbtree_compact_begin() instead.
+ * --------------------------------------------------------------------*/
+int compact_begin(Compactor *c, Tree **root, NodePool *old_pool, NodePool *pool)
+{
+    if (c == NULL || root == NULL || pool == NULL || pool == old_pool)
+        return FAILURE;
+
+    c->root = root;
+    c->tree = NULL;
+    c->old_pool = old_pool;
+    c->pool = pool;
+    c->total = count_nodes(*root);
+    c->moved = c->next = 0;
+    c->side = 0;
+
+    if (pool_init(pool, c->total ? c->total : 1) != SUCCESS)
+        return FAILURE;
+
+    // Allocate the block now so a later step cannot fail midway
+    c->block = pool_alloc(pool);
+    if (c->block == NULL)
+        return FAILURE;
+    pool->slab_used = 0;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: compact_step()
+ * Description: Relocates up to @budget nodes and returns how many are
+ *              still left (0 once the tree is fully compacted). An
+ *              RBTree switches to the new pool once the last node moves.
+ * --------------------------------------------------------------------*/
+size_t compact_step(Compactor *c, size_t budget)
+{
+    while (budget > 0 && c->moved < c->total)
+    {
+        if (c->moved == 0)
+        {
+            relocate(c, *c->root);
+            budget--;
+            continue;
+        }
+
+        Tree *parent = &c->block[c->next];
+        Tree *child = c->side ? parent->right : parent->left;
+        if (c->side)
+            c->next++;
+        c->side = !c->side;
+
+        if (child)
+        {
+            relocate(c, child);
+            budget--;
+        }
+    }
+
+    if (c->moved == c->total)
+    {
+        // Later inserts get ordinary slabs, not another block this size
+        c->pool->slab_nodes = c->pool->slab_used = POOL_SLAB_NODES;
+        if (c->tree)
+            c->tree->pool = c->pool;
+    }
+    return c->total - c->moved;
+}
+
+/* --------------------------------------------------------------------
+ * Function: compact_tree()
+ * Description: Compacts *root into @pool in a single call.
+ * --------------------------------------------------------------------*/
+int compact_tree(Tree **root, NodePool *old_pool, NodePool *pool)
+{
+    Compactor c;
+
+    if (compact_begin(&c, root, old_pool, pool) != SUCCESS)
+        return FAILURE;
+    compact_step(&c, (size_t)-1);
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_compact_begin()
+ * Description: compact_begin() for an RBTree: compacts tree->root out
+ *              of tree->pool into @pool, and relocate() keeps tree->min
+ *              and tree->max pointing at the moved nodes, so the handle
+ *              can be read between steps. Other Tree * handles into
+ *              the tree still become invalid.
+ * --------------------------------------------------------------------*/
+int rbtree_compact_begin(Compactor *c, RBTree *tree, NodePool *pool)
+{
+    if (tree == NULL || compact_begin(c, &tree->root, tree->pool, pool) != SUCCESS)
+        return FAILURE;
+
+    c->tree = tree;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_compact()
+ * Description: Compacts an RBTree into @pool in a single call.
+ * --------------------------------------------------------------------*/
+int rbtree_compact(RBTree *tree, NodePool *pool)
+{
+    Compactor c;
+
+    if (rbtree_compact_begin(&c, tree, pool) != SUCCESS)
+        return FAILURE;
+    compact_step(&c, (size_t)-1);
+    return SUCCESS;
+}
@@ -0,0 +1,65 @@
+/***********************************************************************
+ *  File Name   : compact.h
+ *  Description : Header file for tree compaction.
+ *                Relocates every node of a tree, in BFS order, into one
+ *                contiguous slab of a fresh NodePool, keeping the shape,
+ *                colors and all links, and releases the old nodes. The
+ *                work can be spread over many bounded compact_step()
+ *                calls; between steps the tree is complete and valid.
+ *
+ *                Every node moves, so any Tree * held across compaction
+ *                (search results, cursors, RBTree handles) is left
+ *                dangling. Compact an RBTree with rbtree_compact_begin()
+ *                or rbtree_compact(), which keep its cached min/max and
+ *                its pool up to date.
+ *
+ *  Functions:
+ *                - compact_begin() : Start compacting a tree
+ *                - compact_step()  : Relocate up to a budget of nodes
+ *                - compact_tree()  : Compact in one go
+ *                - rbtree_compact_begin() / rbtree_compact()
+ *                                  : The same for an RBTree handle
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef COMPACT_H
+#define COMPACT_H
+
+#include "tree.h"
+
+/**
+ * struct Compactor - State of an incremental compaction
+ * @root     : Tree being compacted
+ * @tree     : RBTree owning @root, whose min/max follow the moves
+ *             (NULL for a bare tree)
+ * @old_pool : Where the old nodes go back to (NULL = free())
+ * @pool     : Pool receiving the nodes; its first slab is the block
+ * @block    : Relocated nodes, in BFS order
+ * @total    : Number of nodes to relocate
+ * @moved    : Number relocated so far
+ * @next     : Index in @block of the next node whose children move
+ * @side     : Which child of block[@next] moves next (0 left, 1 right)
+ */
+typedef struct Compactor
+{
+    Tree **root;
+    RBTree *tree;
+    NodePool *old_pool;
+    NodePool *pool;
+    Tree *block;
+    size_t total;
+    size_t moved;
+    size_t next;
+    int side;
+} Compactor;
+
+int compact_begin(Compactor *c, Tree **root, NodePool *old_pool, NodePool *pool);
+size_t compact_step(Compactor *c, size_t budget);
+int compact_tree(Tree **root, NodePool *old_pool, NodePool *pool);
+int rbtree_compact_begin(Compactor *c, RBTree *tree, NodePool *pool);
+int rbtree_compact(RBTree *tree, NodePool *pool);
+
+#endif /* COMPACT_H */
@@ -0,0 +1,390 @@
+/***********************************************************************
+ *  File Name   : ctree.c
+ *  Description : Compact, index-based Red-Black Tree.
+ *                Same algorithms as tree.c (rotations, insertion fixup,
+ *                deletion with double-black fixup), but every link is a
+ *                32-bit index into one node array, giving 16-byte nodes.
+ *                Because nodes are addressed by index, growing the array
+ *                with realloc() never invalidates the tree.
+ *
+ *  Functions:
+ *      - ctree_init()
+ *      - ctree_destroy()
+ *      - alloc_slot()
+ *      - ctree_right_rotate()
+ *      - ctree_left_rotate()
+ *      - ctree_insert()
+ *      - ctree_insert_fixup()
+ *      - ctree_fix_double_black()
+ *      - ctree_delete()
+ *      - ctree_search()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "ctree.h"
+
+/* Short local names for the node fields of the tree being worked on */
+#define LEFT(i) (tree->nodes[i].left)
+#define RIGHT(i) (tree->nodes[i].right)
+#define PARENT(i) CNODE_PARENT(tree, i)
+#define COLOR(i) CNODE_COLOR(tree, i)
+
+/* --------------------------------------------------------------------
+ * Function: ctree_init()
+ * Description: Prepares an empty tree with room for @capacity nodes
+ *              (the array grows on demand beyond that).
+ * --------------------------------------------------------------------*/
+int ctree_init(CTree *tree, uint32_t capacity)
+{
+    if (tree == NULL || capacity >= CTREE_MAX_NODES)
+        return FAILURE;
+
+    tree->capacity = capacity + 1;   // +1 for the CNIL slot
+    tree->nodes = malloc(tree->capacity * sizeof(CNode));
+    if (tree->nodes == NULL)
+        return FAILURE;
+
+    tree->root = CNIL;
+    tree->free_list = CNIL;
+    tree->used = 1;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: ctree_destroy()
+ * Description: Frees the node array, releasing the whole tree at once.
+ * --------------------------------------------------------------------*/
+int ctree_destroy(CTree *tree)
+{
+    if (tree == NULL)
+        return FAILURE;
+
+    free(tree->nodes);
+    tree->nodes = NULL;
+    tree->root = tree->free_list = CNIL;
+    tree->used = tree->capacity = 0;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: alloc_slot()
+ * Description: Returns a free node index, reusing released slots first
+ *              and doubling the array when it is full. CNIL on failure.
+ * --------------------------------------------------------------------*/
+static uint32_t alloc_slot(CTree *tree)
+{
+    if (tree->free_list != CNIL)
+    {
+        uint32_t slot = tree->free_list;
+        tree->free_list = LEFT(slot);
+        return slot;
+    }
+
+    if (tree->used == tree->capacity)
+    {
+        if (tree->capacity > CTREE_MAX_NODES / 2)
+            return CNIL;
+
+        uint32_t capacity = tree->capacity ? tree->capacity * 2 : 16;
+        CNode *nodes = realloc(tree->nodes, capacity * sizeof(CNode));
+        if (nodes == NULL)
+            return CNIL;
+        tree->nodes = nodes;
+        tree->capacity = capacity;
+    }
+    return tree->used++;
+}
+
+/* --------------------------------------------------------------------
+ * Function: ctree_right_rotate()
+ * Description: Performs a right rotation on a given node.
+ * --------------------------------------------------------------------*/
+void ctree_right_rotate(CTree *tree, uint32_t node)
+{
+    uint32_t temp = LEFT(node);
+    LEFT(node) = RIGHT(temp);
+    if (RIGHT(temp) != CNIL)
+        CSET_PARENT(tree, RIGHT(temp), node);
+
+    CSET_PARENT(tree, temp, PARENT(node));
+
+    if (PARENT(node) == CNIL)
+        tree->root = temp;
+    else if (node == RIGHT(PARENT(node)))
+        RIGHT(PARENT(node)) = temp;
+    else
+        LEFT(PARENT(node)) = temp;
+
+    RIGHT(temp) = node;
+    CSET_PARENT(tree, node, temp);
+}
+
+/* --------------------------------------------------------------------
+ * Function: ctree_left_rotate()
+ * Description: Performs a left rotation on a given node.
+ * --------------------------------------------------------------------*/
+void ctree_left_rotate(CTree *tree, uint32_t node)
+{
+    uint32_t temp = RIGHT(node);
+    RIGHT(node) = LEFT(temp);
+    if (LEFT(temp) != CNIL)
+        CSET_PARENT(tree, LEFT(temp), node);
+
+    CSET_PARENT(tree, temp, PARENT(node));
+
+    if (PARENT(node) == CNIL)
+        tree->root = temp;
+    else if (node == LEFT(PARENT(node)))
+        LEFT(PARENT(node)) = temp;
+    else
+        RIGHT(PARENT(node)) = temp;
+
+    LEFT(temp) = node;
+    CSET_PARENT(tree, node, temp);
+}
+
+/* --------------------------------------------------------------------
+ * Function: ctree_insert()
+ * Description: Inserts a value and rebalances the tree.
+ *              Returns SUCCESS, DUPLICATE or FAILURE.
+ * --------------------------------------------------------------------*/
+int ctree_insert(CTree *tree, int data)
+{
+    uint32_t temp = tree->root, prev = CNIL;
+
+    // Standard BST insertion
+    while (temp != CNIL)
+    {
+        prev = temp;
+        if (data < tree->nodes[temp].data)
+            temp = LEFT(temp);
+        else if (data > tree->nodes[temp].data)
+            temp = RIGHT(temp);
+        else
+            return DUPLICATE;  // Duplicate not allowed
+    }
+
+    uint32_t newNode = alloc_slot(tree);
+    if (newNode == CNIL)
+        return FAILURE;
+
+    tree->nodes[newNode].data = data;
+    LEFT(newNode) = RIGHT(newNode) = CNIL;
+    tree->nodes[newNode].parent_color = (prev << 1) | RED;
+
+    if (prev == CNIL)
+        tree->root = newNode;
+    else if (data < tree->nodes[prev].data)
+        LEFT(prev) = newNode;
+    else
+        RIGHT(prev) = newNode;
+
+    ctree_insert_fixup(tree, newNode);
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: ctree_insert_fixup()
+ * Description: Restores Red-Black properties after a new RED node
+ *              has been linked into the tree as a leaf.
+ * --------------------------------------------------------------------*/
+void ctree_insert_fixup(CTree *tree, uint32_t node)
+{
+    uint32_t uncle;
+    while (node != tree->root && COLOR(PARENT(node)) == RED)
+    {
+        uint32_t grand = PARENT(PARENT(node));
+        if (PARENT(node) == LEFT(grand))
+        {
+            uncle = RIGHT(grand);
+            if (uncle != CNIL && COLOR(uncle) == RED)
+            {
+                // Case 1: Recoloring
+                CSET_COLOR(tree, uncle, BLACK);
+                CSET_COLOR(tree, PARENT(node), BLACK);
+                CSET_COLOR(tree, grand, RED);
+                node = grand;
+            }
+            else
+            {
+                // Case 2/3: Rotation
+                if (node == RIGHT(PARENT(node)))
+                {
+                    node = PARENT(node);
+                    ctree_left_rotate(tree, node);
+                }
+                CSET_COLOR(tree, PARENT(node), BLACK);
+                CSET_COLOR(tree, grand, RED);
+                ctree_right_rotate(tree, grand);
+            }
+        }
+        else
+        {
+            uncle = LEFT(grand);
+            if (uncle != CNIL && COLOR(uncle) == RED)
+            {
+                CSET_COLOR(tree, uncle, BLACK);
+                CSET_COLOR(tree, PARENT(node), BLACK);
+                CSET_COLOR(tree, grand, RED);
+                node = grand;
+            }
+            else
+            {
+                if (node == LEFT(PARENT(node)))
+                {
+                    node = PARENT(node);
+                    ctree_right_rotate(tree, node);
+                }
+                CSET_COLOR(tree, PARENT(node), BLACK);
+                CSET_COLOR(tree, grand, RED);
+                ctree_left_rotate(tree, grand);
+            }
+        }
+    }
+    CSET_COLOR(tree, tree->root, BLACK);
+}
+
+/* --------------------------------------------------------------------
+ * Function: ctree_fix_double_black()
+ * Description: Fixes Red-Black property violations caused by
+ *              deleting a black node.
+ * --------------------------------------------------------------------*/
+void ctree_fix_double_black(CTree *tree, uint32_t node)
+{
+    if (node == tree->root)
+        return;
+
+    uint32_t parent = PARENT(node);
+    uint32_t sibling = (node == LEFT(parent)) ? RIGHT(parent) : LEFT(parent);
+    int sibling_left = (sibling == LEFT(parent));
+
+    if (sibling == CNIL)
+    {
+        ctree_fix_double_black(tree, parent);
+    }
+    else if (COLOR(sibling) == RED)
+    {
+        CSET_COLOR(tree, parent, RED);
+        CSET_COLOR(tree, sibling, BLACK);
+        if (sibling_left)
+            ctree_right_rotate(tree, parent);
+        else
+            ctree_left_rotate(tree, parent);
+        ctree_fix_double_black(tree, node);
+    }
+    else if (LEFT(sibling) != CNIL && COLOR(LEFT(sibling)) == RED)
+    {
+        if (sibling_left)
+        {
+            CSET_COLOR(tree, LEFT(sibling), COLOR(sibling));
+            CSET_COLOR(tree, sibling, COLOR(parent));
+            ctree_right_rotate(tree, parent);
+        }
+        else
+        {
+            CSET_COLOR(tree, LEFT(sibling), COLOR(parent));
+            ctree_right_rotate(tree, sibling);
+            ctree_left_rotate(tree, parent);
+        }
+        CSET_COLOR(tree, parent, BLACK);
+    }
+    else if (RIGHT(sibling) != CNIL && COLOR(RIGHT(sibling)) == RED)
+    {
+        if (sibling_left)
+        {
+            CSET_COLOR(tree, RIGHT(sibling), COLOR(parent));
+            ctree_left_rotate(tree, sibling);
+            ctree_right_rotate(tree, parent);
+        }
+        else
+        {
+            CSET_COLOR(tree, RIGHT(sibling), COLOR(sibling));
+            CSET_COLOR(tree, sibling, COLOR(parent));
+            ctree_left_rotate(tree, parent);
+        }
+        CSET_COLOR(tree, parent, BLACK);
+    }
+    else
+    {
+        CSET_COLOR(tree, sibling, RED);
+        if (COLOR(parent) == BLACK)
+            ctree_fix_double_black(tree, parent);
+        else
+            CSET_COLOR(tree, parent, BLACK);
+    }
+}
+
+/* --------------------------------------------------------------------
+ * Function: ctree_delete()
+ * Description: Deletes a node by value and restores Red-Black balance.
+ *              The freed slot is kept for reuse by later inserts.
+ * --------------------------------------------------------------------*/
+int ctree_delete(CTree *tree, int data)
+{
+    if (tree->root == CNIL)
+        return FAILURE;
+
+    uint32_t temp = tree->root;
+    while (temp != CNIL && tree->nodes[temp].data != data)
+        temp = (data < tree->nodes[temp].data) ? LEFT(temp) : RIGHT(temp);
+
+    if (temp == CNIL)
+        return DATA_NOT_FOUND;
+
+    uint32_t to_delete = temp;
+    if (LEFT(temp) != CNIL && RIGHT(temp) != CNIL)
+    {
+        uint32_t succ = RIGHT(temp);
+        while (LEFT(succ) != CNIL)
+            succ = LEFT(succ);
+        tree->nodes[temp].data = tree->nodes[succ].data;
+        to_delete = succ;
+    }
+
+    uint32_t child = (LEFT(to_delete) != CNIL) ? LEFT(to_delete) : RIGHT(to_delete);
+    int db = ((child == CNIL || COLOR(child) == BLACK) && COLOR(to_delete) == BLACK);
+
+    // A childless black node is fixed while still linked
+    if (db && child == CNIL)
+        ctree_fix_double_black(tree, to_delete);
+
+    uint32_t parent = PARENT(to_delete);
+    if (child != CNIL)
+        CSET_PARENT(tree, child, parent);
+
+    if (parent == CNIL)
+        tree->root = child;
+    else if (to_delete == LEFT(parent))
+        LEFT(parent) = child;
+    else
+        RIGHT(parent) = child;
+
+    if (db && child != CNIL)
+        ctree_fix_double_black(tree, child);
+    else if (child != CNIL)
+        CSET_COLOR(tree, child, BLACK);
+
+    LEFT(to_delete) = tree->free_list;
+    tree->free_list = to_delete;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: ctree_search()
+ * Description: Searches for a node by value.
+ * --------------------------------------------------------------------*/
+int ctree_search(const CTree *tree, int data)
+{
+    uint32_t node = tree->root;
+
+    while (node != CNIL)
+    {
+        if (tree->nodes[node].data == data)
+            return SUCCESS;
+        node = (data < tree->nodes[node].data) ? LEFT(node) : RIGHT(node);
+    }
+    return DATA_NOT_FOUND;
+}
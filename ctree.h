@@ -0,0 +1,93 @@
+/***********************************************************************
+ *  File Name   : ctree.h
+ *  Description : Header file for the compact, index-based Red-Black
+ *                Tree. Nodes live in one growable array and link to
+ *                each other with 32-bit indices instead of pointers.
+ *                The color shares a word with the parent index, so a
+ *                node is 16 bytes: twice as many per cache line as
+ *                struct Tree.
+ *
+ *  Functions:
+ *                - ctree_init() / ctree_destroy()       : Setup/teardown
+ *                - ctree_left_rotate() / ctree_right_rotate()
+ *                - ctree_insert() / ctree_insert_fixup()
+ *                - ctree_delete() / ctree_fix_double_black()
+ *                - ctree_search()                       : Search by value
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef CTREE_H
+#define CTREE_H
+
+#include "tree.h"
+
+/*--------------------------------------------------------------
+ *                      INDEX MACROS
+ *-------------------------------------------------------------*/
+#define CNIL 0                     // index 0 is never a real node
+#define CTREE_MAX_NODES 0x7FFFFFFFu // parent index keeps 31 bits
+
+/**
+ * struct CNode - A 16-byte Red-Black Tree node
+ * @data         : Integer data stored in the node
+ * @left         : Index of the left child (CNIL if none)
+ * @right        : Index of the right child (CNIL if none)
+ * @parent_color : Parent index shifted left by one, color in bit 0
+ */
+typedef struct CNode
+{
+    int data;
+    uint32_t left, right;
+    uint32_t parent_color;
+} CNode;
+
+/**
+ * struct CTree - A compact tree and the node array it owns
+ * @nodes     : Node storage; nodes[CNIL] is unused
+ * @root      : Index of the root node (CNIL when empty)
+ * @free_list : Released slots, chained through their @left index
+ * @used      : Slots handed out so far, including CNIL
+ * @capacity  : Allocated length of @nodes
+ */
+typedef struct CTree
+{
+    CNode *nodes;
+    uint32_t root;
+    uint32_t free_list;
+    uint32_t used;
+    uint32_t capacity;
+} CTree;
+
+/*--------------------------------------------------------------
+ *                      NODE ACCESSORS
+ *-------------------------------------------------------------*/
+#define CNODE_PARENT(t, i) ((t)->nodes[i].parent_color >> 1)
+#define CNODE_COLOR(t, i) ((int)((t)->nodes[i].parent_color & 1))
+#define CSET_PARENT(t, i, p) ((t)->nodes[i].parent_color = ((uint32_t)(p) << 1) | ((t)->nodes[i].parent_color & 1))
+#define CSET_COLOR(t, i, c) ((t)->nodes[i].parent_color = ((t)->nodes[i].parent_color & ~1u) | (uint32_t)(c))
+
+/*--------------------------------------------------------------
+ *                      FUNCTION DECLARATIONS
+ *-------------------------------------------------------------*/
+
+/* Setup and teardown */
+int ctree_init(CTree *tree, uint32_t capacity);
+int ctree_destroy(CTree *tree);
+
+/* Rotation operations */
+void ctree_left_rotate(CTree *tree, uint32_t node);
+void ctree_right_rotate(CTree *tree, uint32_t node);
+
+/* Node operations */
+int ctree_insert(CTree *tree, int data);
+int ctree_delete(CTree *tree, int data);
+int ctree_search(const CTree *tree, int data);
+
+/* Tree balancing & fixing */
+void ctree_insert_fixup(CTree *tree, uint32_t node);
+void ctree_fix_double_black(CTree *tree, uint32_t node);
+
+#endif /* CTREE_H */
@@ -0,0 +1,226 @@
+/***********************************************************************
+ *  File Name   : cursor.c
+ *  Description : In-order cursor over the Red-Black Tree.
+ *                seek_node() positions a cursor on the first key >= a
+ *                bound in O(log n); next_node()/prev_node() step it.
+ *                With RB_THREADED a step follows the node's own
+ *                successor/predecessor link in O(1); otherwise it
+ *                climbs parent links (amortized O(1), O(log n) worst
+ *                case). A range scan of k keys costs O(log n + k).
+ *                With RB_LAZY_DELETE all three step over tombstones.
+ *                visit_tree() and next_batch() run whole in-order walks
+ *                on the same steps: no recursion, no stack, no
+ *                allocation.
+ *
+ *  Functions:
+ *      - climb_next()
+ *      - climb_prev()
+ *      - step_next()
+ *      - step_prev()
+ *      - seek_node()
+ *      - next_node()
+ *      - prev_node()
+ *      - visit_tree()
+ *      - next_batch()
+ *      - thread_tree()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <limits.h>
+#include "tree.h"
+
+/* --------------------------------------------------------------------
+ * Helper Function: climb_next()
+ * Description: In-order successor of @node through child and parent
+ *              links (NULL after the largest key). On the way down to
+ *              a leftmost node it prefetches each right child passed,
+ *              since the walk comes back up to every one of them.
+ * --------------------------------------------------------------------*/
+static Tree *climb_next(Tree *node)
+{
+    if (node->right)
+    {
+        node = node->right;
+        while (node->left)
+        {
+            if (node->right)
+                __builtin_prefetch(node->right);
+            node = node->left;
+        }
+        return node;
+    }
+
+    while (NODE_PARENT(node) && node == NODE_PARENT(node)->right)
+        node = NODE_PARENT(node);
+    return NODE_PARENT(node);
+}
+
+#ifndef RB_THREADED
+/* --------------------------------------------------------------------
+ * Helper Function: climb_prev()
+ * Description: Mirror image of climb_next().
+ * --------------------------------------------------------------------*/
+static Tree *climb_prev(Tree *node)
+{
+    if (node->left)
+    {
+        node = node->left;
+        while (node->right)
+            node = node->right;
+        return node;
+    }
+
+    while (NODE_PARENT(node) && node == NODE_PARENT(node)->left)
+        node = NODE_PARENT(node);
+    return NODE_PARENT(node);
+}
+#endif
+
+/* --------------------------------------------------------------------
+ * Helper Function: step_next()
+ * Description: In-order successor of @node, tombstone or not.
+ * --------------------------------------------------------------------*/
+static Tree *step_next(Tree *node)
+{
+#ifdef RB_THREADED
+    return node->next;
+#else
+    return climb_next(node);
+#endif
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: step_prev()
+ * Description: In-order predecessor of @node, tombstone or not.
+ * --------------------------------------------------------------------*/
+static Tree *step_prev(Tree *node)
+{
+#ifdef RB_THREADED
+    return node->prev;
+#else
+    return climb_prev(node);
+#endif
+}
+
+/* --------------------------------------------------------------------
+ * Function: seek_node()
+ * Description: Returns the node with the smallest key >= @data, or
+ *              NULL if every key is smaller.
+ * --------------------------------------------------------------------*/
+Tree *seek_node(Tree *root, int data)
+{
+    Tree *best = NULL;
+
+    while (root)
+    {
+        STAT_INC(comparisons);
+        if (root->data == data)
+        {
+            best = root;
+            break;
+        }
+        if (data < root->data)
+        {
+            best = root;
+            root = root->left;
+        }
+        else
+            root = root->right;
+    }
+
+    while (best && NODE_DEAD(best))
+        best = step_next(best);
+    return best;
+}
+
+/* --------------------------------------------------------------------
+ * Function: next_node()
+ * Description: Returns the in-order successor of @node (NULL at the
+ *              end).
+ * --------------------------------------------------------------------*/
+Tree *next_node(Tree *node)
+{
+    do
+        node = step_next(node);
+    while (node && NODE_DEAD(node));
+    return node;
+}
+
+/* --------------------------------------------------------------------
+ * Function: prev_node()
+ * Description: Returns the in-order predecessor of @node (NULL at the
+ *              start).
+ * --------------------------------------------------------------------*/
+Tree *prev_node(Tree *node)
+{
+    do
+        node = step_prev(node);
+    while (node && NODE_DEAD(node));
+    return node;
+}
+
+/* --------------------------------------------------------------------
+ * Function: visit_tree()
+ * Description: Calls @visit on every node of the tree rooted at @root
+ *              (a whole tree, not a subtree) in ascending key order. A
+ *              non-SUCCESS return from @visit stops the walk and is
+ *              passed back; otherwise returns SUCCESS. @visit must not
+ *              unlink nodes.
+ * --------------------------------------------------------------------*/
+int visit_tree(Tree *root, TreeVisitor visit, void *arg)
+{
+    for (Tree *node = seek_node(root, INT_MIN); node; node = next_node(node))
+    {
+        int flag = visit(node, arg);
+        if (flag != SUCCESS)
+            return flag;
+    }
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: next_batch()
+ * Description: Copies up to @max keys into @keys, in order, starting
+ *              at *cursor, and leaves *cursor on the first key not
+ *              copied (NULL at the end). Start with *cursor =
+ *              seek_node(root, lo). Returns the number of keys copied.
+ * --------------------------------------------------------------------*/
+size_t next_batch(Tree **cursor, int *keys, size_t max)
+{
+    Tree *node = *cursor;
+    size_t n = 0;
+
+    while (node && n < max)
+    {
+        keys[n++] = node->data;
+        node = next_node(node);
+    }
+    *cursor = node;
+    return n;
+}
+
+#ifdef RB_THREADED
+/* --------------------------------------------------------------------
+ * Function: thread_tree()
+ * Description: Rebuilds the successor/predecessor links of a whole
+ *              tree in O(n), for code that builds or relinks nodes
+ *              without going through insert/delete.
+ * --------------------------------------------------------------------*/
+void thread_tree(Tree *root)
+{
+    Tree *prev = NULL;
+
+    for (Tree *node = findmin(root); node; node = climb_next(node))
+    {
+        node->prev = prev;
+        if (prev)
+            prev->next = node;
+        prev = node;
+    }
+    if (prev)
+        prev->next = NULL;
+}
+#endif
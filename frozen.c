@@ -0,0 +1,106 @@
+/***********************************************************************
+ *  File Name   : frozen.c
+ *  Description : Frozen, read-only snapshots of a Red-Black Tree.
+ *                The snapshot stores only keys, in Eytzinger order, and
+ *                is searched with a branch-free descent that prefetches
+ *                the cache line holding the slots four levels below.
+ *                frozen_search() returns the same results as
+ *                search_node() for the tree the snapshot was taken from.
+ *
+ *  Functions:
+ *      - fill_eytzinger()
+ *      - freeze()
+ *      - frozen_search()
+ *      - frozen_free()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "frozen.h"
+
+/* --------------------------------------------------------------------
+ * Helper Function: fill_eytzinger()
+ * Description: Visits slots of the implicit tree in order, handing
+ *              each one the next key of the Red-Black Tree.
+ * --------------------------------------------------------------------*/
+static void fill_eytzinger(FrozenTree *frozen, size_t slot, Tree **cursor)
+{
+    if (slot > frozen->count)
+        return;
+
+    fill_eytzinger(frozen, 2 * slot, cursor);
+    frozen->keys[slot] = (*cursor)->data;
+    *cursor = next_node(*cursor);
+    fill_eytzinger(frozen, 2 * slot + 1, cursor);
+}
+
+/* --------------------------------------------------------------------
+ * Function: freeze()
+ * Description: Builds an immutable Eytzinger snapshot of the tree in
+ *              O(n). Returns NULL if memory runs out.
+ * --------------------------------------------------------------------*/
+FrozenTree *freeze(Tree *root)
+{
+    FrozenTree *frozen = malloc(sizeof(FrozenTree));
+    if (frozen == NULL)
+        return NULL;
+
+    Tree *cursor = findmin(root);
+    if (cursor && NODE_DEAD(cursor))
+        cursor = next_node(cursor);
+    frozen->count = 0;
+    for (Tree *node = cursor; node; node = next_node(node))
+        frozen->count++;
+
+    // Round up to whole cache lines, as aligned_alloc() requires
+    size_t bytes = (frozen->count + 1) * sizeof(int);
+    bytes = (bytes + FROZEN_ALIGN - 1) / FROZEN_ALIGN * FROZEN_ALIGN;
+
+    frozen->keys = aligned_alloc(FROZEN_ALIGN, bytes);
+    if (frozen->keys == NULL)
+    {
+        free(frozen);
+        return NULL;
+    }
+
+    fill_eytzinger(frozen, 1, &cursor);
+    return frozen;
+}
+
+/* --------------------------------------------------------------------
+ * Function: frozen_search()
+ * Description: Searches the snapshot for a value. Each step moves to
+ *              slot 2k or 2k+1 without a branch; the final slot index
+ *              encodes the path, and dropping the trailing right turns
+ *              yields the smallest key >= @data.
+ * --------------------------------------------------------------------*/
+int frozen_search(const FrozenTree *frozen, int data)
+{
+    const int *keys = frozen->keys;
+    size_t n = frozen->count, k = 1;
+
+    while (k <= n)
+    {
+        // 16 ints per cache line: slot 16k starts four levels down
+        __builtin_prefetch(keys + 16 * k);
+        k = 2 * k + (keys[k] < data);
+    }
+    k >>= __builtin_ffsl((long)~k);
+
+    return (k != 0 && keys[k] == data) ? SUCCESS : DATA_NOT_FOUND;
+}
+
+/* --------------------------------------------------------------------
+ * Function: frozen_free()
+ * Description: Releases a snapshot returned by freeze().
+ * --------------------------------------------------------------------*/
+void frozen_free(FrozenTree *frozen)
+{
+    if (frozen == NULL)
+        return;
+
+    free(frozen->keys);
+    free(frozen);
+}
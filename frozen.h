@@ -0,0 +1,41 @@
+/***********************************************************************
+ *  File Name   : frozen.h
+ *  Description : Header file for frozen, read-only tree snapshots.
+ *                freeze() copies the keys of a Red-Black Tree into an
+ *                Eytzinger (BFS-order) array: the children of slot k sit
+ *                at 2k and 2k+1, so the top levels share a few cache
+ *                lines and the next levels can be prefetched.
+ *
+ *  Functions:
+ *                - freeze()        : Build a snapshot from a tree
+ *                - frozen_search() : Search the snapshot
+ *                - frozen_free()   : Release the snapshot
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef FROZEN_H
+#define FROZEN_H
+
+#include "tree.h"
+
+#define FROZEN_ALIGN 64   // cache line size the key array is aligned to
+
+/**
+ * struct FrozenTree - Immutable search snapshot of a tree
+ * @keys  : Keys in Eytzinger order, 1-based (keys[0] is unused)
+ * @count : Number of keys
+ */
+typedef struct FrozenTree
+{
+    int *keys;
+    size_t count;
+} FrozenTree;
+
+FrozenTree *freeze(Tree *root);
+int frozen_search(const FrozenTree *frozen, int data);
+void frozen_free(FrozenTree *frozen);
+
+#endif /* FROZEN_H */
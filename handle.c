@@ -0,0 +1,212 @@
+/***********************************************************************
+ *  File Name   : handle.c
+ *  Description : RBTree handle: a root pointer bundled with its node
+ *                pool, node count and cached smallest/largest nodes.
+ *                The extremes are kept up to date by every insert and
+ *                erase through the handle, so they are read in O(1);
+ *                inserts past either end are hinted at that end.
+ *                That makes the handle a priority queue: pop_min() and
+ *                pop_max() unlink the cached extreme directly (it has
+ *                at most one child, so no successor swap and no search)
+ *                in amortized O(1).
+ *
+ *  Functions:
+ *      - rbtree_init()
+ *      - rbtree_insert()
+ *      - rbtree_erase()
+ *      - rbtree_delete()
+ *      - rbtree_destroy()
+ *      - rbtree_peek_min() / rbtree_peek_max()
+ *      - rbtree_pop_min() / rbtree_pop_max()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "tree.h"
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_init()
+ * Description: Prepares an empty handle taking nodes from @pool
+ *              (NULL for malloc/free).
+ * --------------------------------------------------------------------*/
+int rbtree_init(RBTree *tree, NodePool *pool)
+{
+    if (tree == NULL)
+        return FAILURE;
+
+    tree->root = tree->min = tree->max = NULL;
+    tree->count = 0;
+    tree->pool = pool;
+#ifdef RB_LAZY_DELETE
+    tree->dead = 0;
+    tree->max_dead_pct = LAZY_MAX_DEAD_PCT;
+#endif
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_insert()
+ * Description: Inserts @data like insert_handle(); @handle may be
+ *              NULL. A key beyond the current max (min) becomes its
+ *              right (left) child straight away, a free slot, so
+ *              enqueueing in order costs O(1) amortized. Inserting the
+ *              key of a tombstone revives that node; while tombstones
+ *              exist the cached extreme is only the live one, so those
+ *              keys go through insert_hint() instead.
+ * --------------------------------------------------------------------*/
+int rbtree_insert(RBTree *tree, int data, Tree **handle)
+{
+    Tree *node;
+    int flag;
+#ifdef RB_LAZY_DELETE
+    int exact = (tree->dead == 0);
+#else
+    int exact = 1;
+#endif
+
+    if (tree->max && data > tree->max->data)
+        flag = exact ? attach_leaf(&tree->root, tree->max, 1, data, &node, tree->pool)
+                     : insert_hint_pool(&tree->root, tree->max, data, &node, tree->pool);
+    else if (tree->min && data < tree->min->data)
+        flag = exact ? attach_leaf(&tree->root, tree->min, 0, data, &node, tree->pool)
+                     : insert_hint_pool(&tree->root, tree->min, data, &node, tree->pool);
+    else
+        flag = insert_handle_pool(&tree->root, data, &node, tree->pool);
+    if (handle)
+        *handle = node;
+#ifdef RB_LAZY_DELETE
+    if (flag == DUPLICATE && NODE_DEAD(node))
+    {
+        SET_DEAD(node, 0);
+        tree->dead--;
+        flag = SUCCESS;
+    }
+#endif
+    if (flag != SUCCESS)
+        return flag;
+
+    tree->count++;
+    if (tree->min == NULL || data < tree->min->data)
+        tree->min = node;
+    if (tree->max == NULL || data > tree->max->data)
+        tree->max = node;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_erase()
+ * Description: Removes @node (a handle into @tree) without searching,
+ *              moving the cached min/max to its neighbour if needed.
+ * --------------------------------------------------------------------*/
+int rbtree_erase(RBTree *tree, Tree *node)
+{
+    if (tree->root == NULL || node == NULL)
+        return FAILURE;
+
+    if (node == tree->min)
+        tree->min = next_node(node);
+    if (node == tree->max)
+        tree->max = prev_node(node);
+
+#ifdef RB_LAZY_DELETE
+    if (NODE_DEAD(node))
+        tree->dead--;
+    else
+#endif
+        tree->count--;
+    return erase_handle_pool(&tree->root, node, tree->pool);
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_delete()
+ * Description: Removes the node holding @data. Returns DATA_NOT_FOUND
+ *              if there is none.
+ * --------------------------------------------------------------------*/
+int rbtree_delete(RBTree *tree, int data)
+{
+    if (tree->root == NULL)
+        return FAILURE;
+
+    Tree *node = seek_node(tree->root, data);
+    if (node == NULL || node->data != data)
+        return DATA_NOT_FOUND;
+    return rbtree_erase(tree, node);
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_destroy()
+ * Description: Frees every node and empties the handle. A pool-backed
+ *              tree releases its nodes with pool_destroy(), so the pool
+ *              must not be shared with other trees.
+ * --------------------------------------------------------------------*/
+int rbtree_destroy(RBTree *tree)
+{
+    if (tree == NULL)
+        return FAILURE;
+
+    if (tree->pool)
+        pool_destroy(tree->pool, &tree->root);
+    else
+        delete_tree(&tree->root);
+    return rbtree_init(tree, tree->pool);
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_peek_min()
+ * Description: Stores the smallest key in *data. Returns LIST_EMPTY
+ *              for an empty tree.
+ * --------------------------------------------------------------------*/
+int rbtree_peek_min(const RBTree *tree, int *data)
+{
+    if (tree->min == NULL)
+        return LIST_EMPTY;
+
+    *data = tree->min->data;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_peek_max()
+ * Description: Stores the largest key in *data. Returns LIST_EMPTY
+ *              for an empty tree.
+ * --------------------------------------------------------------------*/
+int rbtree_peek_max(const RBTree *tree, int *data)
+{
+    if (tree->max == NULL)
+        return LIST_EMPTY;
+
+    *data = tree->max->data;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_pop_min()
+ * Description: Removes the smallest key, storing it in *data (which
+ *              may be NULL). Returns LIST_EMPTY for an empty tree.
+ * --------------------------------------------------------------------*/
+int rbtree_pop_min(RBTree *tree, int *data)
+{
+    if (tree->min == NULL)
+        return LIST_EMPTY;
+
+    if (data)
+        *data = tree->min->data;
+    return rbtree_erase(tree, tree->min);
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_pop_max()
+ * Description: Removes the largest key, storing it in *data (which
+ *              may be NULL). Returns LIST_EMPTY for an empty tree.
+ * --------------------------------------------------------------------*/
+int rbtree_pop_max(RBTree *tree, int *data)
+{
+    if (tree->max == NULL)
+        return LIST_EMPTY;
+
+    if (data)
+        *data = tree->max->data;
+    return rbtree_erase(tree, tree->max);
+}
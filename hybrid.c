@@ -0,0 +1,332 @@
+/***********************************************************************
+ *  File Name   : hybrid.c
+ *  Description : Fat-leaf hybrid tree: Red-Black index over sorted
+ *                key buckets.
+ *                Bucket @b covers [sep(b), sep(next bucket)), where
+ *                sep is the key of its embedded index node. A full
+ *                bucket splits in half and the upper half is linked in
+ *                as the in-order successor, balanced by insert_fixup().
+ *                A bucket under HYBRID_MIN keys merges into or borrows
+ *                from a neighbour, and emptied buckets leave the index
+ *                through erase_handle(), i.e. fix_double_black().
+ *                Separators only change in ways that keep index order.
+ *
+ *                Inside a bucket the rank of a key is one SSE2 compare
+ *                per 4 slots (a scalar loop elsewhere).
+ *
+ *  Functions:
+ *      - bucket_rank()
+ *      - find_bucket()
+ *      - new_bucket()
+ *      - link_after()
+ *      - split_bucket()
+ *      - refill_bucket()
+ *      - hybrid_init()
+ *      - hybrid_insert()
+ *      - hybrid_delete()
+ *      - hybrid_search()
+ *      - hybrid_destroy()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <limits.h>
+#include <string.h>
+#include "hybrid.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* --------------------------------------------------------------------
+ * Helper Function: bucket_rank()
+ * Description: Returns how many keys of @b are below @data. Padding
+ *              slots are INT_MAX, so all HYBRID_K slots can be compared.
+ * --------------------------------------------------------------------*/
+static int bucket_rank(const Bucket *b, int data)
+{
+#ifdef __SSE2__
+    __m128i key = _mm_set1_epi32(data), sum = _mm_setzero_si128();
+
+    // Each matching lane is -1; subtracting counts them per lane
+    for (int i = 0; i < HYBRID_K; i += 4)
+    {
+        __m128i v = _mm_load_si128((const __m128i *)&b->keys[i]);
+        sum = _mm_sub_epi32(sum, _mm_cmplt_epi32(v, key));
+    }
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(sum);
+#else
+    int rank = 0;
+    for (int i = 0; i < HYBRID_K; i++)
+        rank += b->keys[i] < data;
+    return rank;
+#endif
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: find_bucket()
+ * Description: Returns the bucket with the largest separator <= @data,
+ *              or NULL if @data is below every separator.
+ * --------------------------------------------------------------------*/
+static Bucket *find_bucket(Tree *root, int data)
+{
+    Tree *best = NULL;
+
+    while (root)
+    {
+        STAT_INC(comparisons);
+        if (root->data <= data)
+        {
+            best = root;
+            root = root->right;
+        }
+        else
+            root = root->left;
+    }
+    return best ? NODE_BUCKET(best) : NULL;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: new_bucket()
+ * Description: Allocates an empty, unlinked bucket with separator
+ *              @sep. Returns NULL if memory runs out.
+ * --------------------------------------------------------------------*/
+static Bucket *new_bucket(int sep)
+{
+    Bucket *b = aligned_alloc(HYBRID_ALIGN, sizeof(Bucket));
+    if (b == NULL)
+        return NULL;
+
+    STAT_INC(node_allocs);
+    b->node.data = sep;
+    SET_PARENT(&b->node, NULL);
+    b->node.left = b->node.right = NULL;
+    SET_COLOR(&b->node, RED);
+    SET_DEAD(&b->node, 0);
+    SIZE_UPDATE(&b->node);
+#ifdef RB_THREADED
+    b->node.prev = b->node.next = NULL;
+#endif
+    b->count = 0;
+    for (int i = 0; i < HYBRID_K; i++)
+        b->keys[i] = INT_MAX;
+    return b;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: link_after()
+ * Description: Links @node into the index as the in-order successor of
+ *              @prev and rebalances with insert_fixup().
+ * --------------------------------------------------------------------*/
+static void link_after(Tree **root, Tree *prev, Tree *node)
+{
+    Tree *parent = prev;
+    int right = 1;
+
+    if (prev->right)
+    {
+        parent = findmin(prev->right);
+        right = 0;
+    }
+
+    SET_PARENT(node, parent);
+    if (right)
+        parent->right = node;
+    else
+        parent->left = node;
+    SIZE_PATH_INC(parent);
+    THREAD_ATTACH(node, parent, right);
+    insert_fixup(root, node);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: split_bucket()
+ * Description: Moves the upper half of full bucket @b into a new
+ *              bucket linked right after it. Returns FAILURE if memory
+ *              runs out.
+ * --------------------------------------------------------------------*/
+static int split_bucket(HybridTree *tree, Bucket *b)
+{
+    int keep = HYBRID_K / 2;
+    Bucket *upper = new_bucket(b->keys[keep]);
+    if (upper == NULL)
+        return FAILURE;
+
+    upper->count = b->count - keep;
+    memcpy(upper->keys, &b->keys[keep], upper->count * sizeof(int));
+    for (int i = keep; i < b->count; i++)
+        b->keys[i] = INT_MAX;
+    b->count = keep;
+
+    link_after(&tree->root, &b->node, &upper->node);
+    tree->buckets++;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: refill_bucket()
+ * Description: Handles underflow of @b: merges it with a neighbour if
+ *              both fit in one bucket (erasing the right one from the
+ *              index), else evens out the two. An empty last bucket is
+ *              simply erased.
+ * --------------------------------------------------------------------*/
+static void refill_bucket(HybridTree *tree, Bucket *b)
+{
+    Tree *next = next_node(&b->node), *prev = prev_node(&b->node);
+
+    if (next == NULL && prev == NULL)
+    {
+        if (b->count == 0)
+        {
+            erase_handle(&tree->root, &b->node);   // frees the whole bucket
+            tree->buckets--;
+        }
+        return;
+    }
+
+    Bucket *left = next ? b : NODE_BUCKET(prev);
+    Bucket *right = next ? NODE_BUCKET(next) : b;
+    int total = left->count + right->count;
+
+    if (total <= HYBRID_K)
+    {
+        memcpy(&left->keys[left->count], right->keys, right->count * sizeof(int));
+        left->count = total;
+        erase_handle(&tree->root, &right->node);
+        tree->buckets--;
+        return;
+    }
+
+    int keys[2 * HYBRID_K];
+    memcpy(keys, left->keys, left->count * sizeof(int));
+    memcpy(&keys[left->count], right->keys, right->count * sizeof(int));
+
+    left->count = total / 2;
+    right->count = total - left->count;
+    for (int i = 0; i < HYBRID_K; i++)
+    {
+        left->keys[i] = (i < left->count) ? keys[i] : INT_MAX;
+        right->keys[i] = (i < right->count) ? keys[left->count + i] : INT_MAX;
+    }
+    // Still between the two neighbouring separators, so order holds
+    right->node.data = right->keys[0];
+}
+
+/* --------------------------------------------------------------------
+ * Function: hybrid_init()
+ * Description: Prepares an empty hybrid tree.
+ * --------------------------------------------------------------------*/
+int hybrid_init(HybridTree *tree)
+{
+    if (tree == NULL)
+        return FAILURE;
+
+    tree->root = NULL;
+    tree->count = tree->buckets = 0;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: hybrid_insert()
+ * Description: Inserts @data into its bucket, splitting the bucket
+ *              first if it is full. Returns DUPLICATE if present.
+ * --------------------------------------------------------------------*/
+int hybrid_insert(HybridTree *tree, int data)
+{
+    Bucket *b;
+
+    if (tree->root == NULL)
+    {
+        if ((b = new_bucket(data)) == NULL)
+            return FAILURE;
+        SET_COLOR(&b->node, BLACK);
+        tree->root = &b->node;
+        tree->buckets = 1;
+    }
+    else if ((b = find_bucket(tree->root, data)) == NULL)
+    {
+        // Below every separator: the first bucket's may move down
+        b = NODE_BUCKET(findmin(tree->root));
+        b->node.data = data;
+    }
+
+    int rank = bucket_rank(b, data);
+    if (rank < b->count && b->keys[rank] == data)
+        return DUPLICATE;
+
+    if (b->count == HYBRID_K)
+    {
+        if (split_bucket(tree, b) != SUCCESS)
+            return FAILURE;
+        if (rank > b->count)   // keys[K/2] became the new separator
+        {
+            b = NODE_BUCKET(next_node(&b->node));
+            rank -= HYBRID_K / 2;
+        }
+    }
+
+    memmove(&b->keys[rank + 1], &b->keys[rank], (b->count - rank) * sizeof(int));
+    b->keys[rank] = data;
+    b->count++;
+    tree->count++;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: hybrid_delete()
+ * Description: Removes @data from its bucket and rebalances the bucket
+ *              if it drops below HYBRID_MIN keys.
+ * --------------------------------------------------------------------*/
+int hybrid_delete(HybridTree *tree, int data)
+{
+    if (tree->root == NULL)
+        return FAILURE;
+
+    Bucket *b = find_bucket(tree->root, data);
+    if (b == NULL)
+        return DATA_NOT_FOUND;
+
+    int rank = bucket_rank(b, data);
+    if (rank >= b->count || b->keys[rank] != data)
+        return DATA_NOT_FOUND;
+
+    memmove(&b->keys[rank], &b->keys[rank + 1], (b->count - rank - 1) * sizeof(int));
+    b->keys[--b->count] = INT_MAX;
+    tree->count--;
+
+    if (b->count < HYBRID_MIN)
+        refill_bucket(tree, b);
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: hybrid_search()
+ * Description: Searches for @data: an index descent over the buckets,
+ *              then one rank computation inside the bucket found.
+ * --------------------------------------------------------------------*/
+int hybrid_search(const HybridTree *tree, int data)
+{
+    Bucket *b = find_bucket(tree->root, data);
+    if (b == NULL)
+        return DATA_NOT_FOUND;
+
+    int rank = bucket_rank(b, data);
+    return (rank < b->count && b->keys[rank] == data) ? SUCCESS : DATA_NOT_FOUND;
+}
+
+/* --------------------------------------------------------------------
+ * Function: hybrid_destroy()
+ * Description: Frees every bucket (each index node is the start of its
+ *              bucket's allocation) and empties the tree.
+ * --------------------------------------------------------------------*/
+int hybrid_destroy(HybridTree *tree)
+{
+    if (tree == NULL)
+        return FAILURE;
+
+    delete_tree(&tree->root);
+    return hybrid_init(tree);
+}
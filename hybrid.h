@@ -0,0 +1,67 @@
+/***********************************************************************
+ *  File Name   : hybrid.h
+ *  Description : Header file for the fat-leaf hybrid tree.
+ *                A Red-Black Tree indexes buckets of up to HYBRID_K
+ *                sorted keys. Each bucket embeds its index node, keyed
+ *                by a separator no larger than any key it holds, so the
+ *                index has about n / HYBRID_K nodes and a lookup makes
+ *                that many fewer dependent hops.
+ *
+ *  Functions:
+ *                - hybrid_init()    : Prepare an empty tree
+ *                - hybrid_insert()  : Insert a key
+ *                - hybrid_delete()  : Delete a key
+ *                - hybrid_search()  : Search for a key
+ *                - hybrid_destroy() : Free all buckets
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef HYBRID_H
+#define HYBRID_H
+
+#include "tree.h"
+
+/*--------------------------------------------------------------
+ *                      BUCKET MACROS
+ *-------------------------------------------------------------*/
+#define HYBRID_K 64                  // keys per bucket, a multiple of 4
+#define HYBRID_MIN (HYBRID_K / 4)    // below this a bucket merges or borrows
+#define HYBRID_ALIGN 64              // cache line size buckets are aligned to
+#define NODE_BUCKET(n) ((Bucket *)(n))
+
+/**
+ * struct Bucket - Sorted leaf bucket of a hybrid tree
+ * @node  : Index node (first member: NODE_BUCKET() casts back)
+ * @count : Number of keys in use
+ * @keys  : Ascending keys; unused slots hold INT_MAX
+ */
+typedef struct Bucket
+{
+    Tree node;
+    int count;
+    int keys[HYBRID_K] __attribute__((aligned(HYBRID_ALIGN)));
+} Bucket;
+
+/**
+ * struct HybridTree - Red-Black index over sorted buckets
+ * @root    : Root of the bucket index
+ * @count   : Number of keys
+ * @buckets : Number of buckets
+ */
+typedef struct HybridTree
+{
+    Tree *root;
+    size_t count;
+    size_t buckets;
+} HybridTree;
+
+int hybrid_init(HybridTree *tree);
+int hybrid_insert(HybridTree *tree, int data);
+int hybrid_delete(HybridTree *tree, int data);
+int hybrid_search(const HybridTree *tree, int data);
+int hybrid_destroy(HybridTree *tree);
+
+#endif /* HYBRID_H */
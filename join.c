@@ -0,0 +1,583 @@
+/***********************************************************************
+ *  File Name   : join.c
+ *  Description : Join, split and join-based set operations for the
+ *                Red-Black Tree.
+ *                join_h() links two trees around a middle node at the
+ *                spine position of matching black height and repairs
+ *                the colors with insert_fixup(), in O(|hl - hr| + 1).
+ *                Black heights are threaded through every call instead
+ *                of being recomputed, so split is O(log n) and union,
+ *                intersection and difference take O(m log(n/m + 1))
+ *                work. Large independent halves of a set operation run
+ *                on their own threads.
+ *
+ *                All operations consume their input trees and relink
+ *                the existing nodes; nodes that drop out are free()d,
+ *                so the inputs must not come from a NodePool. The range
+ *                cuts free nothing themselves and work on any tree.
+ *
+ *                With RB_THREADED every join re-threads its middle node
+ *                against both sides, which adds an O(log n) walk to each
+ *                join.
+ *
+ *  Functions:
+ *      - black_height()
+ *      - detach()
+ *      - join_h()
+ *      - split_h()
+ *      - split_last()
+ *      - join2()
+ *      - set_op()
+ *      - run_set_task()
+ *      - run_set_thread()
+ *      - merge_stats()
+ *      - thread_ends()
+ *      - set_op_top()
+ *      - join_trees()
+ *      - split_tree()
+ *      - union_trees()
+ *      - intersect_trees()
+ *      - subtract_trees()
+ *      - extract_range()
+ *      - delete_range() / delete_range_pool()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <pthread.h>
+#include <unistd.h>
+#include "tree.h"
+
+/**
+ * enum SetOp - Operation carried out by set_op()
+ */
+typedef enum SetOp
+{
+    SET_UNION,
+    SET_INTERSECT,
+    SET_SUBTRACT
+} SetOp;
+
+/**
+ * struct SetTask - One half of a set operation handed to a thread
+ * @op     : Operation to run
+ * @a, @b  : Input trees
+ * @ha, @hb: Their black heights
+ * @spawn  : Remaining levels allowed to start threads
+ * @result : Output tree
+ * @h      : Black height of @result
+ * @stats  : Counters of the worker thread, merged by its parent
+ *           (stays zero without RB_STATS)
+ */
+typedef struct SetTask
+{
+    SetOp op;
+    Tree *a, *b;
+    int ha, hb;
+    int spawn;
+    Tree *result;
+    int h;
+    RBStats stats;
+} SetTask;
+
+/* --------------------------------------------------------------------
+ * Helper Function: black_height()
+ * Description: Counts the BLACK nodes from @node down its left spine.
+ * --------------------------------------------------------------------*/
+static int black_height(Tree *node)
+{
+    int h = 0;
+    for (; node; node = node->left)
+        h += NODE_COLOR(node) == BLACK;
+    return h;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: detach()
+ * Description: Cuts a subtree loose from its parent and returns it.
+ * --------------------------------------------------------------------*/
+static Tree *detach(Tree *node)
+{
+    if (node)
+        SET_PARENT(node, NULL);
+    return node;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: join_h()
+ * Description: Joins @l (black height @hl), the single node @k and @r
+ *              (black height @hr), where every key of @l < k < every
+ *              key of @r. Roots are blackened first; @k then goes in
+ *              as a RED node on the right spine of the taller tree (or
+ *              the left spine of @r) where the black heights match,
+ *              exactly like an insertion, and insert_fixup() repairs
+ *              it. Stores the result's black height in *h.
+ * --------------------------------------------------------------------*/
+static Tree *join_h(Tree *l, int hl, Tree *k, Tree *r, int hr, int *h)
+{
+#ifdef RB_THREADED
+    // Thread @k between the two sides (an O(log n) walk per join)
+    Tree *lmax = l, *rmin = findmin(r);
+    while (lmax && lmax->right)
+        lmax = lmax->right;
+    k->prev = lmax;
+    k->next = rmin;
+    if (lmax)
+        lmax->next = k;
+    if (rmin)
+        rmin->prev = k;
+#endif
+
+    if (l && NODE_COLOR(l) == RED)
+    {
+        SET_COLOR(l, BLACK);
+        hl++;
+    }
+    if (r && NODE_COLOR(r) == RED)
+    {
+        SET_COLOR(r, BLACK);
+        hr++;
+    }
+    SET_COLOR(k, RED);
+
+    if (hl == hr)
+    {
+        k->left = l;
+        k->right = r;
+        if (l)
+            SET_PARENT(l, k);
+        if (r)
+            SET_PARENT(r, k);
+        SET_PARENT(k, NULL);
+        SIZE_UPDATE(k);
+        *h = hl;
+        return k;    // a RED root is fine: the next join blackens it
+    }
+
+    Tree *root = (hl > hr) ? l : r;
+    Tree *parent = NULL, *cur = root;
+    int target = (hl > hr) ? hr : hl, ch = (hl > hr) ? hl : hr;
+
+    // Descend the inner spine to the first BLACK (or NULL) node of
+    // black height @target; NULL has height 0 so the walk always stops
+    while (ch != target || (cur && NODE_COLOR(cur) == RED))
+    {
+        ch -= NODE_COLOR(cur) == BLACK;
+        parent = cur;
+        cur = (hl > hr) ? cur->right : cur->left;
+    }
+
+    if (hl > hr)
+    {
+        k->left = cur;
+        k->right = r;
+        if (r)
+            SET_PARENT(r, k);
+        parent->right = k;
+    }
+    else
+    {
+        k->left = l;
+        k->right = cur;
+        if (l)
+            SET_PARENT(l, k);
+        parent->left = k;
+    }
+    if (cur)
+        SET_PARENT(cur, k);
+    SET_PARENT(k, parent);
+    SIZE_UPDATE(k);
+#ifdef RB_ORDER_STATS
+    for (Tree *p = parent; p; p = NODE_PARENT(p))
+        SIZE_UPDATE(p);
+#endif
+
+    *h = ((hl > hr) ? hl : hr) + insert_fixup(&root, k);
+    return root;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: split_h()
+ * Description: Splits @t (black height @ht) into the keys below and
+ *              above @data. A node holding @data is detached into
+ *              *found (NULL if absent) rather than freed.
+ * --------------------------------------------------------------------*/
+static void split_h(Tree *t, int ht, int data, Tree **l, int *hl,
+                    Tree **r, int *hr, Tree **found)
+{
+    if (t == NULL)
+    {
+        *l = *r = *found = NULL;
+        *hl = *hr = 0;
+        return;
+    }
+
+    int hc = ht - (NODE_COLOR(t) == BLACK);
+    Tree *left = detach(t->left), *right = detach(t->right);
+    Tree *mid;
+    int hm;
+
+    if (data == t->data)
+    {
+        *l = left;
+        *r = right;
+        *hl = *hr = hc;
+        t->left = t->right = NULL;
+        *found = t;
+    }
+    else if (data < t->data)
+    {
+        split_h(left, hc, data, l, hl, &mid, &hm, found);
+        *r = join_h(mid, hm, t, right, hc, hr);
+    }
+    else
+    {
+        split_h(right, hc, data, &mid, &hm, r, hr, found);
+        *l = join_h(left, hc, t, mid, hm, hl);
+    }
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: split_last()
+ * Description: Removes the largest node of non-empty @t into *last and
+ *              returns the rest (black height in *h).
+ * --------------------------------------------------------------------*/
+static Tree *split_last(Tree *t, int ht, Tree **last, int *h)
+{
+    int hc = ht - (NODE_COLOR(t) == BLACK);
+    Tree *left = detach(t->left), *right = detach(t->right);
+
+    if (right == NULL)
+    {
+        t->left = NULL;
+        *last = t;
+        *h = hc;
+        return left;
+    }
+
+    int hm;
+    Tree *mid = split_last(right, hc, last, &hm);
+    return join_h(left, hc, t, mid, hm, h);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: join2()
+ * Description: Joins two trees with no middle key (every key of @l <
+ *              every key of @r) using the largest node of @l.
+ * --------------------------------------------------------------------*/
+static Tree *join2(Tree *l, int hl, Tree *r, int hr, int *h)
+{
+    if (l == NULL)
+    {
+        *h = hr;
+        return r;
+    }
+    if (r == NULL)
+    {
+        *h = hl;
+        return l;
+    }
+
+    Tree *last;
+    int hrest;
+    Tree *rest = split_last(l, hl, &last, &hrest);
+    return join_h(rest, hrest, last, r, hr, h);
+}
+
+static Tree *set_op(SetOp op, Tree *a, int ha, Tree *b, int hb, int spawn, int *h);
+
+/* --------------------------------------------------------------------
+ * Helper Function: run_set_task()
+ * Description: pthread entry point running set_op() on a SetTask.
+ * --------------------------------------------------------------------*/
+static void *run_set_task(void *arg)
+{
+    SetTask *task = arg;
+    task->result = set_op(task->op, task->a, task->ha, task->b, task->hb,
+                          task->spawn, &task->h);
+    return NULL;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: run_set_thread()
+ * Description: Worker-thread entry point: runs the task, then saves the
+ *              thread's own counters in it, since rb_stats is
+ *              thread-local and would die with the thread.
+ * --------------------------------------------------------------------*/
+static void *run_set_thread(void *arg)
+{
+    run_set_task(arg);
+#ifdef RB_STATS
+    ((SetTask *)arg)->stats = rb_stats;
+#endif
+    return NULL;
+}
+
+#ifdef RB_STATS
+/* --------------------------------------------------------------------
+ * Helper Function: merge_stats()
+ * Description: Adds a joined worker's counters to the calling thread's.
+ * --------------------------------------------------------------------*/
+static void merge_stats(const RBStats *worker)
+{
+    rb_stats.left_rotations += worker->left_rotations;
+    rb_stats.right_rotations += worker->right_rotations;
+    rb_stats.recolors += worker->recolors;
+    rb_stats.insert_fixups += worker->insert_fixups;
+    rb_stats.double_black += worker->double_black;
+    if (worker->double_black_max > rb_stats.double_black_max)
+        rb_stats.double_black_max = worker->double_black_max;
+    rb_stats.comparisons += worker->comparisons;
+    rb_stats.node_allocs += worker->node_allocs;
+    rb_stats.node_frees += worker->node_frees;
+}
+#endif
+
+/* --------------------------------------------------------------------
+ * Helper Function: set_op()
+ * Description: Splits @a at the root key of @b, combines the two
+ *              halves recursively and joins them back, keeping or
+ *              dropping the root of @b as @op requires. While @spawn
+ *              allows it and the halves of @b are big enough, the left
+ *              half runs on a new thread.
+ * --------------------------------------------------------------------*/
+static Tree *set_op(SetOp op, Tree *a, int ha, Tree *b, int hb, int spawn, int *h)
+{
+    if (a == NULL || b == NULL)
+    {
+        if (op == SET_UNION || (op == SET_SUBTRACT && b == NULL))
+        {
+            *h = a ? ha : hb;
+            return a ? a : b;
+        }
+        delete_tree(a ? &a : &b);   // nothing of the other side survives
+        *h = 0;
+        return NULL;
+    }
+
+    int hc = hb - (NODE_COLOR(b) == BLACK);
+    Tree *bl = detach(b->left), *br = detach(b->right);
+    Tree *al, *ar, *found;
+    int hal, har;
+    split_h(a, ha, b->data, &al, &hal, &ar, &har, &found);
+
+    SetTask left = { op, al, bl, hal, hc, spawn - 1, NULL, 0, { 0 } };
+    SetTask right = { op, ar, br, har, hc, spawn - 1, NULL, 0, { 0 } };
+    pthread_t tid;
+    int threaded = spawn > 0 && hc >= SETOP_PAR_HEIGHT &&
+                   pthread_create(&tid, NULL, run_set_thread, &left) == 0;
+
+    if (!threaded)
+        run_set_task(&left);
+    run_set_task(&right);
+    if (threaded)
+    {
+        pthread_join(tid, NULL);
+#ifdef RB_STATS
+        merge_stats(&left.stats);
+#endif
+    }
+
+    int keep = (op == SET_UNION) || (op == SET_INTERSECT && found);
+    if (found)
+        pool_free(NULL, found);
+
+    if (keep)
+        return join_h(left.result, left.h, b, right.result, right.h, h);
+
+    pool_free(NULL, b);
+    return join2(left.result, left.h, right.result, right.h, h);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: thread_ends()
+ * Description: Clears the outward links of a finished tree's smallest
+ *              and largest nodes, which may still point at nodes now in
+ *              another tree or freed.
+ * --------------------------------------------------------------------*/
+static void thread_ends(Tree *root)
+{
+#ifdef RB_THREADED
+    Tree *max = root;
+    while (max && max->right)
+        max = max->right;
+    if (max)
+    {
+        max->next = NULL;
+        findmin(root)->prev = NULL;
+    }
+#else
+    (void)root;
+#endif
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: set_op_top()
+ * Description: Runs a set operation with threads allowed on the first
+ *              log2(cores) + 1 levels, and blackens the final root.
+ * --------------------------------------------------------------------*/
+static Tree *set_op_top(SetOp op, Tree *a, Tree *b)
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int spawn = 1, h;
+
+    while (cores > 1)
+    {
+        spawn++;
+        cores >>= 1;
+    }
+
+    Tree *root = set_op(op, a, black_height(a), b, black_height(b), spawn, &h);
+    if (root)
+        SET_COLOR(root, BLACK);
+    thread_ends(root);
+    return root;
+}
+
+/* --------------------------------------------------------------------
+ * Function: join_trees()
+ * Description: Stores in *root the union of @left, a new node holding
+ *              @data, and @right. Every key of @left must be below
+ *              @data and every key of @right above it; otherwise, or
+ *              if allocation fails, FAILURE is returned and the inputs
+ *              are left untouched.
+ * --------------------------------------------------------------------*/
+int join_trees(Tree **root, Tree *left, int data, Tree *right)
+{
+    Tree *max = left, *min = findmin(right);
+    while (max && max->right)
+        max = max->right;
+
+    if ((max && max->data >= data) || (min && min->data <= data))
+        return FAILURE;
+
+    Tree *node = create_node_pool(data, NULL);
+    if (node == NULL)
+        return FAILURE;
+
+    int h;
+    *root = join_h(left, black_height(left), node, right, black_height(right), &h);
+    SET_COLOR(*root, BLACK);
+    thread_ends(*root);
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: split_tree()
+ * Description: Splits *root into *left (keys < @data) and *right
+ *              (keys > @data) and empties *root. A node holding @data
+ *              is freed. Returns SUCCESS if @data was present, else
+ *              DATA_NOT_FOUND.
+ * --------------------------------------------------------------------*/
+int split_tree(Tree **root, int data, Tree **left, Tree **right)
+{
+    Tree *found;
+    int hl, hr;
+
+    split_h(*root, black_height(*root), data, left, &hl, right, &hr, &found);
+    *root = NULL;
+    if (*left)
+        SET_COLOR(*left, BLACK);
+    if (*right)
+        SET_COLOR(*right, BLACK);
+    thread_ends(*left);
+    thread_ends(*right);
+
+    if (found == NULL)
+        return DATA_NOT_FOUND;
+    pool_free(NULL, found);
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: union_trees()
+ * Description: Returns a tree of the keys in @a or @b, consuming both.
+ * --------------------------------------------------------------------*/
+Tree *union_trees(Tree *a, Tree *b)
+{
+    return set_op_top(SET_UNION, a, b);
+}
+
+/* --------------------------------------------------------------------
+ * Function: intersect_trees()
+ * Description: Returns a tree of the keys in both @a and @b, consuming
+ *              both.
+ * --------------------------------------------------------------------*/
+Tree *intersect_trees(Tree *a, Tree *b)
+{
+    return set_op_top(SET_INTERSECT, a, b);
+}
+
+/* --------------------------------------------------------------------
+ * Function: subtract_trees()
+ * Description: Returns a tree of the keys in @a but not in @b,
+ *              consuming both.
+ * --------------------------------------------------------------------*/
+Tree *subtract_trees(Tree *a, Tree *b)
+{
+    return set_op_top(SET_SUBTRACT, a, b);
+}
+
+/* --------------------------------------------------------------------
+ * Function: extract_range()
+ * Description: Moves every key in [@lo, @hi] out of *root into a tree
+ *              of its own, stored in *range, with two splits and three
+ *              joins: O(log n) whatever the size of the range. Returns
+ *              DATA_NOT_FOUND if the range was empty, FAILURE if
+ *              @lo > @hi.
+ * --------------------------------------------------------------------*/
+int extract_range(Tree **root, int lo, int hi, Tree **range)
+{
+    Tree *left, *rest, *mid, *right, *lo_node, *hi_node;
+    int hl, hrest, hm, hr, h;
+
+    *range = NULL;
+    if (lo > hi)
+        return FAILURE;
+
+    split_h(*root, black_height(*root), lo, &left, &hl, &rest, &hrest, &lo_node);
+    split_h(rest, hrest, hi, &mid, &hm, &right, &hr, &hi_node);
+
+    // The bounds themselves were split out as single nodes
+    if (lo_node)
+        mid = join_h(NULL, 0, lo_node, mid, hm, &hm);
+    if (hi_node)
+        mid = join_h(mid, hm, hi_node, NULL, 0, &hm);
+    *root = join2(left, hl, right, hr, &h);
+
+    if (*root)
+        SET_COLOR(*root, BLACK);
+    if (mid)
+        SET_COLOR(mid, BLACK);
+    thread_ends(*root);
+    thread_ends(mid);
+
+    *range = mid;
+    return mid ? SUCCESS : DATA_NOT_FOUND;
+}
+
+/* --------------------------------------------------------------------
+ * Function: delete_range()
+ * Description: Deletes every key in [@lo, @hi]: one extract_range()
+ *              and a single pass freeing the cut-out nodes, instead of
+ *              a search and fixup per key.
+ * --------------------------------------------------------------------*/
+int delete_range(Tree **root, int lo, int hi)
+{
+    return delete_range_pool(root, lo, hi, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: delete_range_pool()
+ * Description: Same as delete_range(), returning the nodes to @pool.
+ * --------------------------------------------------------------------*/
+int delete_range_pool(Tree **root, int lo, int hi, NodePool *pool)
+{
+    Tree *range;
+    int flag = extract_range(root, lo, hi, &range);
+
+    delete_tree_pool(&range, pool);
+    return flag;
+}
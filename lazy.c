@@ -0,0 +1,151 @@
+/***********************************************************************
+ *  File Name   : lazy.c
+ *  Description : Lazy deletion for the RBTree handle (RB_LAZY_DELETE).
+ *                rbtree_lazy_delete() costs one search and sets the
+ *                node's tombstone bit: no successor swap, rotation or
+ *                recolor. search_node(), search_many() and the cursor
+ *                treat tombstones as absent, and inserting the key
+ *                again revives the node. Once tombstones pass
+ *                max_dead_pct percent of the nodes, rbtree_purge() frees
+ *                them and relinks the live nodes into a balanced tree in
+ *                one linear pass, so the whole burst pays for one
+ *                rebuild instead of a fixup per delete.
+ *
+ *                The purge moves no live node, so handles to live keys
+ *                stay valid. With RB_ORDER_STATS, subtree sizes count
+ *                tombstones until the next purge.
+ *
+ *                Only some raw Tree ** mutators are tombstone-safe (see
+ *                LAZY DELETION in tree.h); purge before a raw insert,
+ *                split/join, set operation or order-statistics query.
+ *
+ *  Functions:
+ *      - collect_live()
+ *      - relink()
+ *      - rbtree_lazy_delete()
+ *      - rbtree_purge()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "tree.h"
+
+#ifdef RB_LAZY_DELETE
+/* --------------------------------------------------------------------
+ * Helper Function: collect_live()
+ * Description: Walks a subtree in order, appending live nodes to
+ *              nodes[*n] and returning tombstones to @pool.
+ * --------------------------------------------------------------------*/
+static void collect_live(Tree *node, Tree **nodes, size_t *n, NodePool *pool)
+{
+    while (node)
+    {
+        Tree *right = node->right;
+
+        collect_live(node->left, nodes, n, pool);
+        if (NODE_DEAD(node))
+            pool_free(pool, node);
+        else
+            nodes[(*n)++] = node;
+        node = right;
+    }
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: relink()
+ * Description: Links nodes[lo, hi) into a perfectly balanced subtree
+ *              under @parent, colored by depth as in build_from_sorted():
+ *              only the partial level @red_depth is RED.
+ * --------------------------------------------------------------------*/
+static Tree *relink(Tree **nodes, size_t lo, size_t hi, int depth, int red_depth, Tree *parent)
+{
+    if (lo >= hi)
+        return NULL;
+
+    size_t mid = lo + (hi - lo) / 2;
+    Tree *node = nodes[mid];
+
+    SET_PARENT(node, parent);
+    SET_COLOR(node, (depth == red_depth) ? RED : BLACK);
+#ifdef RB_ORDER_STATS
+    node->size = (unsigned int)(hi - lo);
+#endif
+    node->left = relink(nodes, lo, mid, depth + 1, red_depth, node);
+    node->right = relink(nodes, mid + 1, hi, depth + 1, red_depth, node);
+    return node;
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_lazy_delete()
+ * Description: Marks the node holding @data as a tombstone, then
+ *              purges if tombstones now exceed max_dead_pct percent of
+ *              the nodes. Returns DATA_NOT_FOUND if @data is absent or
+ *              already a tombstone.
+ * --------------------------------------------------------------------*/
+int rbtree_lazy_delete(RBTree *tree, int data)
+{
+    Tree *node = tree->root;
+
+    if (node == NULL)
+        return FAILURE;
+
+    while (node && node->data != data)
+    {
+        STAT_INC(comparisons);
+        node = (data < node->data) ? node->left : node->right;
+    }
+    if (node == NULL || NODE_DEAD(node))
+        return DATA_NOT_FOUND;
+
+    SET_DEAD(node, 1);
+    tree->count--;
+    tree->dead++;
+    if (node == tree->min)
+        tree->min = next_node(node);
+    if (node == tree->max)
+        tree->max = prev_node(node);
+
+    if (tree->dead * 100 > (size_t)tree->max_dead_pct * (tree->count + tree->dead))
+        rbtree_purge(tree);    // on FAILURE the tombstones just stay
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: rbtree_purge()
+ * Description: Frees every tombstone and rebuilds the live nodes into
+ *              a balanced tree in O(n), in place. Returns FAILURE (the
+ *              tree unchanged) if the temporary node array cannot be
+ *              allocated.
+ * --------------------------------------------------------------------*/
+int rbtree_purge(RBTree *tree)
+{
+    if (tree->dead == 0)
+        return SUCCESS;
+
+    Tree **nodes = malloc((tree->count ? tree->count : 1) * sizeof(Tree *));
+    if (nodes == NULL)
+        return FAILURE;
+
+    size_t n = 0;
+    collect_live(tree->root, nodes, &n, tree->pool);
+
+    // Levels 0 .. red_depth-1 are full; red_depth = floor(log2(n + 1))
+    int red_depth = 0;
+    for (size_t full = n + 1; full > 1; full >>= 1)
+        red_depth++;
+
+    tree->root = relink(nodes, 0, n, 0, red_depth, NULL);
+#ifdef RB_THREADED
+    for (size_t i = 0; i < n; i++)
+    {
+        nodes[i]->prev = i ? nodes[i - 1] : NULL;
+        nodes[i]->next = (i + 1 < n) ? nodes[i + 1] : NULL;
+    }
+#endif
+    tree->dead = 0;
+    free(nodes);
+    return SUCCESS;
+}
+#endif
@@ -9,8 +9,13 @@
  *                  4. Deleting Entire Tree
  *                  5. Inorder Traversal (Tree Visualization)
  *
+ *                Run as "rbtree -b [file]" to replay a command stream
+ *                from a file (or stdin when omitted or "-") in batch
+ *                mode instead of showing the menu; see batch.h.
+ *
  *                Functions:
  *                - main()             : Handles the main menu loop.
+ *                - run_batch()        : Replays a command stream (batch mode).
  *                - insert_node()      : Inserts a new node and maintains RB balance.
  *                - search_node()      : Searches for a specific node value.
  *                - delete_node()      : Removes a node and fixes tree balance.
@@ -22,10 +27,27 @@
  *  Date        : 30-oct-2025
  ***********************************************************************/
 
+#include <string.h>
 #include "tree.h"
+#include "batch.h"
 
-int main()
+int main(int argc, char *argv[])
 {
+    if (argc > 1 && strcmp(argv[1], "-b") == 0)
+    {
+        FILE *in = stdin;
+        if (argc > 2 && strcmp(argv[2], "-") != 0 && (in = fopen(argv[2], "rb")) == NULL)
+        {
+            perror(argv[2]);
+            return 1;
+        }
+
+        int flag = run_batch(in);
+        if (in != stdin)
+            fclose(in);
+        return (flag == SUCCESS) ? 0 : 1;
+    }
+
     Tree *root = NULL;    // Root pointer for the Red-Black Tree
     char choice;           // Menu option
     int data, flag;        // Data for node operations and status flag
@@ -0,0 +1,110 @@
+/***********************************************************************
+ *  File Name   : pool.c
+ *  Description : Slab allocator for Red-Black Tree nodes.
+ *                Nodes are carved out of large fixed-size slabs and
+ *                recycled through a free list, so insert/delete avoid a
+ *                malloc/free per node. A tree built on a pool is torn
+ *                down by releasing its slabs, without visiting nodes.
+ *
+ *  Functions:
+ *      - pool_init()
+ *      - pool_alloc()
+ *      - pool_free()
+ *      - pool_destroy()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "tree.h"
+
+/* --------------------------------------------------------------------
+ * Function: pool_init()
+ * Description: Prepares an empty pool. Slabs are allocated lazily,
+ *              @slab_nodes nodes at a time (0 selects POOL_SLAB_NODES).
+ * --------------------------------------------------------------------*/
+int pool_init(NodePool *pool, size_t slab_nodes)
+{
+    if (pool == NULL)
+        return FAILURE;
+
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->slab_nodes = slab_nodes ? slab_nodes : POOL_SLAB_NODES;
+    pool->slab_used = pool->slab_nodes;   // forces a slab on first alloc
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: pool_alloc()
+ * Description: Returns an uninitialized node, reusing a freed one when
+ *              possible. Falls back to malloc when @pool is NULL.
+ * --------------------------------------------------------------------*/
+Tree *pool_alloc(NodePool *pool)
+{
+    STAT_INC(node_allocs);
+    if (pool == NULL)
+        return malloc(sizeof(Tree));
+
+    if (pool->free_list)
+    {
+        Tree *node = pool->free_list;
+        pool->free_list = node->right;
+        return node;
+    }
+
+    if (pool->slab_used == pool->slab_nodes)
+    {
+        Slab *slab = malloc(sizeof(Slab) + pool->slab_nodes * sizeof(Tree));
+        if (slab == NULL)
+            return NULL;
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+        pool->slab_used = 0;
+    }
+    return &pool->slabs->nodes[pool->slab_used++];
+}
+
+/* --------------------------------------------------------------------
+ * Function: pool_free()
+ * Description: Pushes a node onto the pool's free list
+ *              (or frees it when @pool is NULL).
+ * --------------------------------------------------------------------*/
+void pool_free(NodePool *pool, Tree *node)
+{
+    STAT_INC(node_frees);
+    if (pool == NULL)
+    {
+        free(node);
+        return;
+    }
+
+    node->right = pool->free_list;
+    pool->free_list = node;
+}
+
+/* --------------------------------------------------------------------
+ * Function: pool_destroy()
+ * Description: Releases every slab owned by the pool in one pass over
+ *              the slab list. @root (optional) is reset to NULL since
+ *              all of its nodes are gone.
+ * --------------------------------------------------------------------*/
+int pool_destroy(NodePool *pool, Tree **root)
+{
+    if (pool == NULL)
+        return FAILURE;
+
+    while (pool->slabs)
+    {
+        Slab *next = pool->slabs->next;
+        free(pool->slabs);
+        pool->slabs = next;
+    }
+    pool->free_list = NULL;
+    pool->slab_used = pool->slab_nodes;
+
+    if (root)
+        *root = NULL;
+    return SUCCESS;
+}
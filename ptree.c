@@ -0,0 +1,557 @@
+/***********************************************************************
+ *  File Name   : ptree.c
+ *  Description : Persistent (path-copying) Red-Black Tree and its
+ *                lock-free-reader wrapper.
+ *
+ *                An update copies the root-to-leaf path and every other
+ *                node it has to recolor or rotate; all other subtrees are
+ *                shared with the previous version. A node whose count is
+ *                1 and that hangs off a fresh copy belongs to the new
+ *                version alone and is changed in place. The rebalancing
+ *                cases are the ones tree.c uses, written against a path
+ *                stack because shared nodes cannot keep a parent pointer.
+ *
+ *  Functions:
+ *      - is_red()
+ *      - clone_node()
+ *      - own_child()
+ *      - rotate()
+ *      - abort_version()
+ *      - pt_insert()
+ *      - pt_delete()
+ *      - pt_search()
+ *      - pt_retain()
+ *      - pt_release()
+ *      - reclaim()
+ *      - publish()
+ *      - ptree_init()
+ *      - ptree_destroy()
+ *      - ptree_insert()
+ *      - ptree_delete()
+ *      - ptree_read_begin()
+ *      - ptree_read_end()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <limits.h>
+#include "ptree.h"
+
+/* Parent of path[i] and the side path[i] hangs on (root has none) */
+#define PARENT_AT(i) ((i) > 0 ? path[(i) - 1] : NULL)
+#define DIR_AT(i) ((i) > 0 ? dirs[(i) - 1] : 0)
+
+/* --------------------------------------------------------------------
+ * Helper Function: is_red()
+ * Description: Treats missing children as BLACK.
+ * --------------------------------------------------------------------*/
+static int is_red(const PNode *node)
+{
+    return node && node->color == RED;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: clone_node()
+ * Description: Copies a node. The copy starts with one reference and
+ *              adds a reference to each child it now shares.
+ * --------------------------------------------------------------------*/
+static PNode *clone_node(const PNode *node)
+{
+    PNode *copy = malloc(sizeof(PNode));
+    if (copy == NULL)
+        return NULL;
+
+    *copy = *node;
+    copy->refs = 1;
+    for (int i = 0; i < 2; i++)
+        if (copy->link[i])
+            copy->link[i]->refs++;
+    return copy;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: own_child()
+ * Description: Makes the child of a fresh @parent (or the root when
+ *              @parent is NULL) private to the new version, copying it
+ *              if another version still points at it. Returns the
+ *              writable child, or NULL if the copy failed.
+ * --------------------------------------------------------------------*/
+static PNode *own_child(PNode **root, PNode *parent, int dir)
+{
+    PNode **slot = parent ? &parent->link[dir] : root;
+    PNode *child = *slot;
+
+    if (child->refs == 1)
+        return child;
+
+    PNode *copy = clone_node(child);
+    if (copy == NULL)
+        return NULL;
+
+    child->refs--;
+    *slot = copy;
+    return copy;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: rotate()
+ * Description: Rotates @node towards @dir (dir 0 = left rotation),
+ *              lifting its child on the other side. @node, the lifted
+ *              child and @parent must be private to the new version.
+ *              Reference counts are unchanged: every moved pointer
+ *              keeps exactly one referrer.
+ * --------------------------------------------------------------------*/
+static PNode *rotate(PNode **root, PNode *parent, int pdir, PNode *node, int dir)
+{
+    PNode *lift = node->link[!dir];
+
+    node->link[!dir] = lift->link[dir];
+    lift->link[dir] = node;
+
+    if (parent)
+        parent->link[pdir] = lift;
+    else
+        *root = lift;
+    return lift;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: abort_version()
+ * Description: Drops a half-built version after an allocation failure
+ *              and hands the caller the unchanged one instead.
+ * --------------------------------------------------------------------*/
+static PNode *abort_version(PNode *copy, PNode *root, int *status)
+{
+    pt_release(copy);
+    *status = FAILURE;
+    return pt_retain(root);
+}
+
+/* --------------------------------------------------------------------
+ * Function: pt_insert()
+ * Description: Returns a new version containing @data; @root is left
+ *              untouched. @status receives SUCCESS, DUPLICATE or
+ *              FAILURE. The caller owns one reference to the result
+ *              (which is @root itself, retained, unless SUCCESS).
+ * --------------------------------------------------------------------*/
+PNode *pt_insert(PNode *root, int data, int *status)
+{
+    PNode *path[PTREE_MAX_DEPTH];
+    int dirs[PTREE_MAX_DEPTH];
+    int d = 0;
+
+    // Search first, so a duplicate copies nothing
+    for (PNode *node = root; node; node = node->link[data > node->data], d++)
+    {
+        if (node->data == data)
+        {
+            *status = DUPLICATE;
+            return pt_retain(root);
+        }
+    }
+    if (d >= PTREE_MAX_DEPTH - 1)
+        return abort_version(NULL, root, status);
+
+    PNode *leaf = malloc(sizeof(PNode));
+    if (leaf == NULL)
+        return abort_version(NULL, root, status);
+    leaf->data = data;
+    leaf->color = RED;
+    leaf->refs = 1;
+    leaf->link[0] = leaf->link[1] = NULL;
+
+    // Copy the search path
+    PNode *copy = NULL;
+    d = 0;
+    if (root)
+    {
+        if ((copy = clone_node(root)) == NULL)
+        {
+            free(leaf);
+            return abort_version(NULL, root, status);
+        }
+
+        PNode *node = copy;
+        while (1)
+        {
+            path[d] = node;
+            dirs[d] = data > node->data;
+            if (node->link[dirs[d]] == NULL)
+                break;
+            if ((node = own_child(&copy, node, dirs[d])) == NULL)
+            {
+                free(leaf);
+                return abort_version(copy, root, status);
+            }
+            d++;
+        }
+        path[d]->link[dirs[d]] = leaf;
+        d++;
+    }
+    else
+        copy = leaf;
+    path[d] = leaf;
+
+    // Fix Red-Black Tree violations (same cases as insert_fixup)
+    while (d >= 2 && path[d - 1]->color == RED)
+    {
+        PNode *parent = path[d - 1], *grand = path[d - 2];
+        int pdir = dirs[d - 2];
+
+        if (is_red(grand->link[!pdir]))
+        {
+            // Case 1: Recoloring
+            PNode *uncle = own_child(&copy, grand, !pdir);
+            if (uncle == NULL)
+                return abort_version(copy, root, status);
+            uncle->color = BLACK;
+            parent->color = BLACK;
+            grand->color = RED;
+            d -= 2;
+            continue;
+        }
+
+        // Case 2/3: Rotation
+        if (dirs[d - 1] != pdir)
+            parent = rotate(&copy, grand, pdir, parent, pdir);
+        parent->color = BLACK;
+        grand->color = RED;
+        rotate(&copy, PARENT_AT(d - 2), DIR_AT(d - 2), grand, !pdir);
+        break;
+    }
+    copy->color = BLACK;
+
+    *status = SUCCESS;
+    return copy;
+}
+
+/* --------------------------------------------------------------------
+ * Function: pt_delete()
+ * Description: Returns a new version without @data; @root is left
+ *              untouched. @status receives SUCCESS, DATA_NOT_FOUND or
+ *              FAILURE, with the same ownership rules as pt_insert().
+ * --------------------------------------------------------------------*/
+PNode *pt_delete(PNode *root, int data, int *status)
+{
+    PNode *path[PTREE_MAX_DEPTH];
+    int dirs[PTREE_MAX_DEPTH];
+    int d = 0;
+
+    PNode *node = root;
+    while (node && node->data != data)
+        node = node->link[data > node->data];
+    if (node == NULL)
+    {
+        *status = DATA_NOT_FOUND;
+        return pt_retain(root);
+    }
+
+    // Copy the path to the victim, and on to its successor if needed
+    PNode *copy = clone_node(root);
+    if (copy == NULL)
+        return abort_version(NULL, root, status);
+
+    node = copy;
+    while (node->data != data)
+    {
+        path[d] = node;
+        dirs[d] = data > node->data;
+        if ((node = own_child(&copy, node, dirs[d])) == NULL)
+            return abort_version(copy, root, status);
+        d++;
+    }
+
+    PNode *victim = node;
+    if (victim->link[0] && victim->link[1])
+    {
+        path[d] = victim;
+        dirs[d] = 1;
+        if ((node = own_child(&copy, victim, 1)) == NULL)
+            return abort_version(copy, root, status);
+        d++;
+
+        while (node->link[0])
+        {
+            path[d] = node;
+            dirs[d] = 0;
+            if ((node = own_child(&copy, node, 0)) == NULL)
+                return abort_version(copy, root, status);
+            d++;
+        }
+        victim->data = node->data;
+    }
+
+    // Splice out the node: its parent inherits the child reference
+    PNode *to_delete = node;
+    PNode *child = to_delete->link[to_delete->link[0] ? 0 : 1];
+    int db = (to_delete->color == BLACK);
+
+    if (d == 0)
+        copy = child;
+    else
+        path[d - 1]->link[dirs[d - 1]] = child;
+    free(to_delete);
+
+    if (db && is_red(child))
+    {
+        if ((child = own_child(&copy, PARENT_AT(d), DIR_AT(d))) == NULL)
+            return abort_version(copy, root, status);
+        child->color = BLACK;
+        db = 0;
+    }
+
+    // Double-black fixup, climbing the path stack (depth d is the hole)
+    while (db && d > 0)
+    {
+        PNode *parent = path[d - 1];
+        int dir = dirs[d - 1];
+        PNode *sibling = own_child(&copy, parent, !dir);
+        if (sibling == NULL)
+            return abort_version(copy, root, status);
+
+        if (sibling->color == RED)
+        {
+            sibling->color = BLACK;
+            parent->color = RED;
+            rotate(&copy, PARENT_AT(d - 1), DIR_AT(d - 1), parent, dir);
+            path[d - 1] = sibling;
+            path[d] = parent;
+            dirs[d] = dir;
+            d++;
+            continue;
+        }
+
+        if (!is_red(sibling->link[0]) && !is_red(sibling->link[1]))
+        {
+            sibling->color = RED;
+            if (parent->color == RED)
+            {
+                parent->color = BLACK;
+                break;
+            }
+            d--;
+            continue;
+        }
+
+        if (!is_red(sibling->link[!dir]))
+        {
+            PNode *near = own_child(&copy, sibling, dir);
+            if (near == NULL)
+                return abort_version(copy, root, status);
+            near->color = BLACK;
+            sibling->color = RED;
+            sibling = rotate(&copy, parent, !dir, sibling, !dir);
+        }
+
+        PNode *far = own_child(&copy, sibling, !dir);
+        if (far == NULL)
+            return abort_version(copy, root, status);
+        sibling->color = parent->color;
+        parent->color = BLACK;
+        far->color = BLACK;
+        rotate(&copy, PARENT_AT(d - 1), DIR_AT(d - 1), parent, dir);
+        break;
+    }
+
+    *status = SUCCESS;
+    return copy;
+}
+
+/* --------------------------------------------------------------------
+ * Function: pt_search()
+ * Description: Searches one version for a value.
+ * --------------------------------------------------------------------*/
+int pt_search(const PNode *root, int data)
+{
+    while (root)
+    {
+        if (root->data == data)
+            return SUCCESS;
+        root = root->link[data > root->data];
+    }
+    return DATA_NOT_FOUND;
+}
+
+/* --------------------------------------------------------------------
+ * Function: pt_retain()
+ * Description: Takes another reference to a version.
+ * --------------------------------------------------------------------*/
+PNode *pt_retain(PNode *root)
+{
+    if (root)
+        root->refs++;
+    return root;
+}
+
+/* --------------------------------------------------------------------
+ * Function: pt_release()
+ * Description: Drops a reference to a version, freeing every node no
+ *              other version shares.
+ * --------------------------------------------------------------------*/
+void pt_release(PNode *root)
+{
+    if (root == NULL || --root->refs > 0)
+        return;
+
+    pt_release(root->link[0]);
+    pt_release(root->link[1]);
+    free(root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: reclaim()
+ * Description: Releases retired versions that no active reader can
+ *              still be using: those replaced before the oldest epoch
+ *              a reader is in. Caller holds the write lock.
+ * --------------------------------------------------------------------*/
+static void reclaim(PTree *pt)
+{
+    unsigned long oldest = ULONG_MAX;
+
+    for (int i = 0; i < PTREE_MAX_READERS; i++)
+    {
+        unsigned long epoch = atomic_load(&pt->active[i]);
+        if (epoch && epoch < oldest)
+            oldest = epoch;
+    }
+
+    PRetired **link = &pt->retired;
+    while (*link)
+    {
+        PRetired *entry = *link;
+        if (entry->epoch < oldest)
+        {
+            *link = entry->next;
+            pt_release(entry->root);
+            free(entry);
+        }
+        else
+            link = &entry->next;
+    }
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: publish()
+ * Description: Swaps in a new version, retires the old one under the
+ *              current epoch and advances the epoch.
+ * --------------------------------------------------------------------*/
+static void publish(PTree *pt, PNode *version, PRetired *entry)
+{
+    entry->root = atomic_exchange(&pt->root, version);
+    entry->epoch = atomic_fetch_add(&pt->epoch, 1);
+    entry->next = pt->retired;
+    pt->retired = entry;
+    reclaim(pt);
+}
+
+/* --------------------------------------------------------------------
+ * Function: ptree_init()
+ * Description: Prepares an empty concurrently readable tree.
+ * --------------------------------------------------------------------*/
+int ptree_init(PTree *pt)
+{
+    if (pt == NULL)
+        return FAILURE;
+
+    atomic_init(&pt->root, NULL);
+    atomic_init(&pt->epoch, 1);   // 0 marks an idle reader slot
+    for (int i = 0; i < PTREE_MAX_READERS; i++)
+        atomic_init(&pt->active[i], 0);
+    pt->retired = NULL;
+    pthread_mutex_init(&pt->write_lock, NULL);
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: ptree_destroy()
+ * Description: Releases the current and all retired versions.
+ *              No reader or writer may still be using @pt.
+ * --------------------------------------------------------------------*/
+int ptree_destroy(PTree *pt)
+{
+    if (pt == NULL)
+        return FAILURE;
+
+    pt_release(atomic_exchange(&pt->root, NULL));
+    while (pt->retired)
+    {
+        PRetired *next = pt->retired->next;
+        pt_release(pt->retired->root);
+        free(pt->retired);
+        pt->retired = next;
+    }
+    pthread_mutex_destroy(&pt->write_lock);
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: ptree_insert()
+ * Description: Inserts a value and publishes the new version.
+ *              Writers are serialized; readers are never blocked.
+ * --------------------------------------------------------------------*/
+int ptree_insert(PTree *pt, int data)
+{
+    int status;
+    PRetired *entry = malloc(sizeof(PRetired));
+    if (entry == NULL)
+        return FAILURE;
+
+    pthread_mutex_lock(&pt->write_lock);
+    PNode *version = pt_insert(atomic_load(&pt->root), data, &status);
+    if (status == SUCCESS)
+        publish(pt, version, entry);
+    else
+    {
+        pt_release(version);
+        free(entry);
+    }
+    pthread_mutex_unlock(&pt->write_lock);
+    return status;
+}
+
+/* --------------------------------------------------------------------
+ * Function: ptree_delete()
+ * Description: Deletes a value and publishes the new version.
+ * --------------------------------------------------------------------*/
+int ptree_delete(PTree *pt, int data)
+{
+    int status;
+    PRetired *entry = malloc(sizeof(PRetired));
+    if (entry == NULL)
+        return FAILURE;
+
+    pthread_mutex_lock(&pt->write_lock);
+    PNode *version = pt_delete(atomic_load(&pt->root), data, &status);
+    if (status == SUCCESS)
+        publish(pt, version, entry);
+    else
+    {
+        pt_release(version);
+        free(entry);
+    }
+    pthread_mutex_unlock(&pt->write_lock);
+    return status;
+}
+
+/* --------------------------------------------------------------------
+ * Function: ptree_read_begin()
+ * Description: Enters reader slot @slot (one per reader thread) and
+ *              returns the current version. The snapshot stays valid,
+ *              and unchanged, until ptree_read_end().
+ * --------------------------------------------------------------------*/
+PNode *ptree_read_begin(PTree *pt, int slot)
+{
+    atomic_store(&pt->active[slot], atomic_load(&pt->epoch));
+    return atomic_load(&pt->root);
+}
+
+/* --------------------------------------------------------------------
+ * Function: ptree_read_end()
+ * Description: Leaves reader slot @slot; its snapshot may be freed.
+ * --------------------------------------------------------------------*/
+void ptree_read_end(PTree *pt, int slot)
+{
+    atomic_store(&pt->active[slot], 0);
+}
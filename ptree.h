@@ -0,0 +1,106 @@
+/***********************************************************************
+ *  File Name   : ptree.h
+ *  Description : Header file for the persistent (copy-on-write)
+ *                Red-Black Tree.
+ *
+ *                pt_insert() / pt_delete() never modify an existing
+ *                version: they copy the nodes they would change and
+ *                return a new root that shares everything else with the
+ *                old one. Nodes carry no parent pointer (a shared node
+ *                has one parent per version); rebalancing walks an
+ *                explicit path stack instead. Shared nodes are counted,
+ *                and pt_release() frees the nodes a dropped version
+ *                owned alone.
+ *
+ *                PTree wraps this for concurrent use: one writer at a
+ *                time publishes new roots atomically, while readers take
+ *                snapshots without locks. Old roots are released through
+ *                epoch-based reclamation once no reader can see them.
+ *
+ *  Functions:
+ *                - pt_insert() / pt_delete()       : New version with/without a key
+ *                - pt_search()                     : Search one version
+ *                - pt_retain() / pt_release()      : Version reference counting
+ *                - ptree_init() / ptree_destroy()  : Concurrent wrapper setup
+ *                - ptree_insert() / ptree_delete() : Serialized writers
+ *                - ptree_read_begin() / ptree_read_end() : Lock-free snapshots
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef PTREE_H
+#define PTREE_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "tree.h"
+
+/*--------------------------------------------------------------
+ *                      PERSISTENT TREE MACROS
+ *-------------------------------------------------------------*/
+#define PTREE_MAX_DEPTH 96     // > 2*log2(2^32) plus room for fixups
+#define PTREE_MAX_READERS 64   // reader slots for epoch tracking
+
+/**
+ * struct PNode - Immutable (once published) persistent tree node
+ * @data  : Integer data stored in the node
+ * @color : Node color (RED / BLACK)
+ * @refs  : Number of parents and version roots pointing at this node
+ * @link  : Children, link[0] = left and link[1] = right
+ */
+typedef struct PNode
+{
+    int data;
+    int color;
+    unsigned int refs;
+    struct PNode *link[2];
+} PNode;
+
+/**
+ * struct PRetired - A replaced root waiting for readers to move on
+ * @root  : Version to release
+ * @epoch : Epoch in which it was replaced
+ * @next  : Next retired version
+ */
+typedef struct PRetired
+{
+    PNode *root;
+    unsigned long epoch;
+    struct PRetired *next;
+} PRetired;
+
+/**
+ * struct PTree - Concurrently readable persistent tree
+ * @root       : Currently published version
+ * @write_lock : Serializes writers (and all reference counting)
+ * @epoch      : Global epoch, advanced on every publish
+ * @active     : Epoch each reader slot entered in, 0 when idle
+ * @retired    : Replaced versions not yet released
+ */
+typedef struct PTree
+{
+    _Atomic(PNode *) root;
+    pthread_mutex_t write_lock;
+    atomic_ulong epoch;
+    atomic_ulong active[PTREE_MAX_READERS];
+    PRetired *retired;
+} PTree;
+
+/* Versions */
+PNode *pt_insert(PNode *root, int data, int *status);
+PNode *pt_delete(PNode *root, int data, int *status);
+int pt_search(const PNode *root, int data);
+PNode *pt_retain(PNode *root);
+void pt_release(PNode *root);
+
+/* Concurrent wrapper */
+int ptree_init(PTree *pt);
+int ptree_destroy(PTree *pt);
+int ptree_insert(PTree *pt, int data);
+int ptree_delete(PTree *pt, int data);
+PNode *ptree_read_begin(PTree *pt, int slot);
+void ptree_read_end(PTree *pt, int slot);
+
+#endif /* PTREE_H */
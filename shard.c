@@ -0,0 +1,442 @@
+/***********************************************************************
+ *  File Name   : shard.c
+ *  Description : Key-range sharded Red-Black Tree for multi-core use.
+ *                An operation takes only the lock of the one shard
+ *                owning its key, so updates to different ranges proceed
+ *                in parallel and share no written cache line. The range
+ *                table is read without a lock and validated against a
+ *                sequence count (a seqlock): a rebalance makes it odd,
+ *                rewrites the table while holding every shard lock, and
+ *                makes it even again, so an operation that raced with
+ *                it sees a changed count and retries.
+ *                When one shard grows far past the average, the ranges
+ *                are re-split so every shard holds the same number of
+ *                keys; each shard is then rebuilt in O(n) with
+ *                build_from_sorted_pool().
+ *
+ *  Functions:
+ *      - shard_index()
+ *      - wait_rebalance()
+ *      - lock_shard()
+ *      - collect_range()
+ *      - count_keys()
+ *      - skew_limit_for()
+ *      - resplit()
+ *      - rebalance_locked()
+ *      - shard_init()
+ *      - shard_destroy()
+ *      - shard_insert()
+ *      - shard_delete()
+ *      - shard_search()
+ *      - shard_range()
+ *      - shard_rebalance()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <limits.h>
+#include "shard.h"
+
+/* --------------------------------------------------------------------
+ * Helper Function: shard_index()
+ * Description: Binary-searches the range table for the shard owning
+ *              @data. The answer is only trusted if the sequence count
+ *              is unchanged once the shard is locked.
+ * --------------------------------------------------------------------*/
+static size_t shard_index(ShardedTree *st, int data)
+{
+    size_t lo = 0, hi = st->nshards;
+
+    while (hi - lo > 1)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (atomic_load_explicit(&st->lower[mid], memory_order_relaxed) <= data)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: wait_rebalance()
+ * Description: Returns an even sequence count, sleeping on the resize
+ *              lock instead of spinning while a rebalance runs.
+ * --------------------------------------------------------------------*/
+static unsigned wait_rebalance(ShardedTree *st)
+{
+    unsigned seq;
+
+    while ((seq = atomic_load_explicit(&st->seq, memory_order_acquire)) & 1)
+    {
+        pthread_mutex_lock(&st->resize_lock);
+        pthread_mutex_unlock(&st->resize_lock);
+    }
+    return seq;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: lock_shard()
+ * Description: Locks the shard owning @data, exclusively if @write is
+ *              set, and returns it. A rebalance rewrites the range
+ *              table only while holding every shard lock, so once the
+ *              lock is held an unchanged sequence count proves the
+ *              index was computed from the current table.
+ * --------------------------------------------------------------------*/
+static Shard *lock_shard(ShardedTree *st, int data, int write)
+{
+    for (;;)
+    {
+        unsigned seq = wait_rebalance(st);
+        Shard *shard = &st->shards[shard_index(st, data)];
+
+        if (write)
+            pthread_rwlock_wrlock(&shard->lock);
+        else
+            pthread_rwlock_rdlock(&shard->lock);
+        if (atomic_load_explicit(&st->seq, memory_order_relaxed) == seq)
+            return shard;
+        pthread_rwlock_unlock(&shard->lock);
+    }
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: collect_range()
+ * Description: Appends the keys of a subtree lying within [lo, hi] to
+ *              @out in ascending order, stopping once @max are stored.
+ * --------------------------------------------------------------------*/
+static void collect_range(Tree *node, int lo, int hi, int *out, size_t max, size_t *count)
+{
+    if (node == NULL || *count >= max)
+        return;
+
+    if (lo < node->data)
+        collect_range(node->left, lo, hi, out, max, count);
+    if (lo <= node->data && node->data <= hi && *count < max)
+        out[(*count)++] = node->data;
+    if (node->data < hi)
+        collect_range(node->right, lo, hi, out, max, count);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: count_keys()
+ * Description: Sums the shard counts, taking each shard lock shared in
+ *              turn, and stores the largest count in *largest. Shards
+ *              keep changing meanwhile, so the sum is only a snapshot.
+ * --------------------------------------------------------------------*/
+static size_t count_keys(ShardedTree *st, size_t *largest)
+{
+    size_t total = 0;
+
+    *largest = 0;
+    for (size_t i = 0; i < st->nshards; i++)
+    {
+        Shard *shard = &st->shards[i];
+
+        pthread_rwlock_rdlock(&shard->lock);
+        total += shard->count;
+        if (shard->count > *largest)
+            *largest = shard->count;
+        pthread_rwlock_unlock(&shard->lock);
+    }
+    return total;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: skew_limit_for()
+ * Description: Returns the shard count that calls for a skew check
+ *              when shards average @average keys.
+ * --------------------------------------------------------------------*/
+static size_t skew_limit_for(size_t average)
+{
+    return SHARD_SKEW_FACTOR * (average > SHARD_MIN_KEYS ? average : SHARD_MIN_KEYS);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: resplit()
+ * Description: Moves the range boundaries so each shard gets an equal
+ *              share of the @total keys and rebuilds every shard from
+ *              the sorted key list. Caller holds every shard lock
+ *              exclusively. The old shards are only released once all
+ *              new ones are built.
+ * --------------------------------------------------------------------*/
+static int resplit(ShardedTree *st, size_t total)
+{
+    size_t n = 0;
+
+    if (total < st->nshards)
+        return SUCCESS;   // too few keys to give every shard one
+
+    int *keys = malloc(total * sizeof(int));
+    NodePool *pools = malloc(st->nshards * sizeof(NodePool));
+    Tree **roots = calloc(st->nshards, sizeof(Tree *));
+    if (keys == NULL || pools == NULL || roots == NULL)
+    {
+        free(keys);
+        free(pools);
+        free(roots);
+        return FAILURE;
+    }
+
+    for (size_t i = 0; i < st->nshards; i++)
+        collect_range(st->shards[i].root, INT_MIN, INT_MAX, keys, total, &n);
+
+    int flag = SUCCESS;
+    for (size_t i = 0; i < st->nshards && flag == SUCCESS; i++)
+    {
+        size_t start = total * i / st->nshards, end = total * (i + 1) / st->nshards;
+
+        pool_init(&pools[i], 0);
+        roots[i] = build_from_sorted_pool(keys + start, end - start, &pools[i]);
+        if (roots[i] == NULL)
+        {
+            flag = FAILURE;
+            for (size_t j = 0; j <= i; j++)
+                pool_destroy(&pools[j], &roots[j]);
+        }
+    }
+
+    if (flag == SUCCESS)
+    {
+        for (size_t i = 0; i < st->nshards; i++)
+        {
+            Shard *shard = &st->shards[i];
+
+            pool_destroy(&shard->pool, &shard->root);
+            shard->pool = pools[i];
+            shard->root = roots[i];
+            shard->count = total * (i + 1) / st->nshards - total * i / st->nshards;
+            if (i > 0)
+                atomic_store_explicit(&st->lower[i], keys[total * i / st->nshards],
+                                      memory_order_relaxed);
+        }
+        atomic_store_explicit(&st->skew_limit, skew_limit_for(total / st->nshards),
+                              memory_order_relaxed);
+    }
+
+    free(keys);
+    free(pools);
+    free(roots);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: rebalance_locked()
+ * Description: Re-splits the shards evenly. Unless @force is set, it
+ *              first re-counts the keys and does nothing when no shard
+ *              is skewed (another thread got here first, or the count
+ *              only crossed a stale limit); skew_limit is then raised
+ *              so the next check waits for real growth. Caller holds
+ *              the resize lock.
+ * --------------------------------------------------------------------*/
+static int rebalance_locked(ShardedTree *st, int force)
+{
+    if (!force)
+    {
+        size_t largest, average = count_keys(st, &largest) / st->nshards;
+        size_t limit = skew_limit_for(average);
+
+        // A false alarm at least doubles the limit, so checks stay rare
+        atomic_store_explicit(&st->skew_limit, limit > 2 * largest ? limit : 2 * largest,
+                              memory_order_relaxed);
+        if (average < SHARD_MIN_KEYS || largest <= SHARD_SKEW_FACTOR * average)
+            return SUCCESS;
+    }
+
+    // Turn new operations away, then wait out the ones in flight
+    atomic_fetch_add_explicit(&st->seq, 1, memory_order_acq_rel);
+    for (size_t i = 0; i < st->nshards; i++)
+        pthread_rwlock_wrlock(&st->shards[i].lock);
+
+    size_t total = 0;
+    for (size_t i = 0; i < st->nshards; i++)
+        total += st->shards[i].count;
+    int flag = resplit(st, total);
+
+    atomic_fetch_add_explicit(&st->seq, 1, memory_order_release);
+    for (size_t i = 0; i < st->nshards; i++)
+        pthread_rwlock_unlock(&st->shards[i].lock);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Function: shard_init()
+ * Description: Creates @nshards empty shards splitting the int range
+ *              into equal parts.
+ * --------------------------------------------------------------------*/
+int shard_init(ShardedTree *st, size_t nshards)
+{
+    if (st == NULL || nshards == 0)
+        return FAILURE;
+
+    st->shards = aligned_alloc(SHARD_ALIGN, nshards * sizeof(Shard));
+    st->lower = malloc(nshards * sizeof(atomic_int));
+    if (st->shards == NULL || st->lower == NULL)
+    {
+        free(st->shards);
+        free(st->lower);
+        return FAILURE;
+    }
+
+    long long span = ((long long)INT_MAX - INT_MIN + 1) / (long long)nshards;
+    for (size_t i = 0; i < nshards; i++)
+    {
+        atomic_init(&st->lower[i], (int)(INT_MIN + span * (long long)i));
+        pthread_rwlock_init(&st->shards[i].lock, NULL);
+        st->shards[i].root = NULL;
+        st->shards[i].count = 0;
+        pool_init(&st->shards[i].pool, 0);
+    }
+
+    pthread_mutex_init(&st->resize_lock, NULL);
+    atomic_init(&st->seq, 0);
+    atomic_init(&st->skew_limit, skew_limit_for(0));
+    st->nshards = nshards;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: shard_destroy()
+ * Description: Frees every shard. No other thread may still use @st.
+ * --------------------------------------------------------------------*/
+int shard_destroy(ShardedTree *st)
+{
+    if (st == NULL || st->shards == NULL)
+        return FAILURE;
+
+    for (size_t i = 0; i < st->nshards; i++)
+    {
+        pool_destroy(&st->shards[i].pool, &st->shards[i].root);
+        pthread_rwlock_destroy(&st->shards[i].lock);
+    }
+    pthread_mutex_destroy(&st->resize_lock);
+
+    free(st->shards);
+    free(st->lower);
+    st->shards = NULL;
+    st->lower = NULL;
+    st->nshards = 0;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: shard_insert()
+ * Description: Thread-safe insert. Checks for skew when the receiving
+ *              shard passes skew_limit; if another thread is already
+ *              rebalancing, leaves the check to it instead of queueing.
+ * --------------------------------------------------------------------*/
+int shard_insert(ShardedTree *st, int data)
+{
+    int flag, skewed = 0;
+    Shard *shard = lock_shard(st, data, 1);
+
+    flag = insert_node_pool(&shard->root, data, &shard->pool);
+    if (flag == SUCCESS)
+    {
+        shard->count++;
+        skewed = shard->count > atomic_load_explicit(&st->skew_limit, memory_order_relaxed);
+    }
+    pthread_rwlock_unlock(&shard->lock);
+
+    if (skewed && pthread_mutex_trylock(&st->resize_lock) == 0)
+    {
+        rebalance_locked(st, 0);
+        pthread_mutex_unlock(&st->resize_lock);
+    }
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Function: shard_delete()
+ * Description: Thread-safe delete. Returns SUCCESS, or DATA_NOT_FOUND
+ *              when @data is absent, whether or not its shard is empty
+ *              (delete_node_pool() reports an empty tree as FAILURE,
+ *              which would leak the shard layout to the caller).
+ * --------------------------------------------------------------------*/
+int shard_delete(ShardedTree *st, int data)
+{
+    int flag;
+    Shard *shard = lock_shard(st, data, 1);
+
+    flag = delete_node_pool(&shard->root, data, &shard->pool);
+    if (flag == FAILURE)
+        flag = DATA_NOT_FOUND;
+    if (flag == SUCCESS)
+        shard->count--;
+    pthread_rwlock_unlock(&shard->lock);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Function: shard_search()
+ * Description: Thread-safe lookup; readers of a shard run concurrently.
+ * --------------------------------------------------------------------*/
+int shard_search(ShardedTree *st, int data)
+{
+    int flag;
+    Shard *shard = lock_shard(st, data, 0);
+
+    flag = search_node(shard->root, data);
+    pthread_rwlock_unlock(&shard->lock);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Function: shard_range()
+ * Description: Copies up to @max keys within [lo, hi] into @out in
+ *              ascending order and returns how many were copied.
+ *              Shards are visited in key order, each under its own
+ *              read lock, so every shard's part is self-consistent.
+ *              A rebalance during the scan restarts it.
+ * --------------------------------------------------------------------*/
+size_t shard_range(ShardedTree *st, int lo, int hi, int *out, size_t max)
+{
+    size_t count = 0;
+    int stale = 1;
+
+    if (lo > hi || out == NULL)
+        return 0;
+
+    while (stale)
+    {
+        unsigned seq = wait_rebalance(st);
+
+        count = 0;
+        stale = 0;
+        for (size_t i = shard_index(st, lo); i < st->nshards && count < max; i++)
+        {
+            if (atomic_load_explicit(&st->lower[i], memory_order_relaxed) > hi)
+                break;
+
+            Shard *shard = &st->shards[i];
+            pthread_rwlock_rdlock(&shard->lock);
+            stale = atomic_load_explicit(&st->seq, memory_order_relaxed) != seq;
+            if (!stale)
+                collect_range(shard->root, lo, hi, out, max, &count);
+            pthread_rwlock_unlock(&shard->lock);
+            if (stale)
+                break;
+        }
+
+        // The boundary that ended the scan was read without a lock
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&st->seq, memory_order_relaxed) != seq)
+            stale = 1;
+    }
+    return count;
+}
+
+/* --------------------------------------------------------------------
+ * Function: shard_rebalance()
+ * Description: Re-splits the key ranges evenly across the shards.
+ *              Blocks all other operations while it runs.
+ * --------------------------------------------------------------------*/
+int shard_rebalance(ShardedTree *st)
+{
+    pthread_mutex_lock(&st->resize_lock);
+    int flag = rebalance_locked(st, 1);
+    pthread_mutex_unlock(&st->resize_lock);
+    return flag;
+}
@@ -0,0 +1,81 @@
+/***********************************************************************
+ *  File Name   : shard.h
+ *  Description : Header file for the key-range sharded Red-Black Tree.
+ *                The key space is split into N contiguous ranges, each
+ *                served by an independent tree with its own lock, so
+ *                writers on different ranges run on different cores.
+ *
+ *  Functions:
+ *                - shard_init() / shard_destroy()  : Setup/teardown
+ *                - shard_insert() / shard_delete() : Thread-safe updates
+ *                - shard_search()                  : Thread-safe lookup
+ *                - shard_range()                   : Cross-shard range scan
+ *                - shard_rebalance()               : Re-split ranges evenly
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef SHARD_H
+#define SHARD_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "tree.h"
+
+/*--------------------------------------------------------------
+ *                      REBALANCING MACROS
+ *-------------------------------------------------------------*/
+#define SHARD_SKEW_FACTOR 4    // rebalance when a shard holds 4x the average
+#define SHARD_MIN_KEYS 1024    // ...and the average shard holds at least this
+#define SHARD_ALIGN 64         // cache line size shards are aligned to
+
+/**
+ * struct Shard - One key range and the tree that stores it
+ * @lock  : Guards @root, @pool and @count
+ * @root  : Root of this shard's Red-Black Tree
+ * @pool  : Node pool the shard's tree is allocated from
+ * @count : Number of keys in this shard
+ *
+ * Each shard fills whole cache lines, so writers on neighbouring
+ * shards never touch the same line.
+ */
+typedef struct Shard
+{
+    pthread_rwlock_t lock;
+    Tree *root;
+    NodePool pool;
+    size_t count;
+} __attribute__((aligned(SHARD_ALIGN))) Shard;
+
+/**
+ * struct ShardedTree - A set of trees partitioned by key range
+ * @resize_lock : Serializes rebalances
+ * @seq         : Odd while a rebalance rewrites @lower; bumped twice
+ *                per rebalance so operations can detect a stale index
+ * @skew_limit  : A shard count above this makes the inserter check for
+ *                skew; raised as the average grows
+ * @shards      : The shards, in key order
+ * @lower       : Shard i holds keys in [lower[i], lower[i + 1])
+ * @nshards     : Number of shards
+ */
+typedef struct ShardedTree
+{
+    pthread_mutex_t resize_lock;
+    atomic_uint seq;
+    atomic_size_t skew_limit;
+    Shard *shards;
+    atomic_int *lower;
+    size_t nshards;
+} ShardedTree;
+
+int shard_init(ShardedTree *st, size_t nshards);
+int shard_destroy(ShardedTree *st);
+int shard_insert(ShardedTree *st, int data);
+int shard_delete(ShardedTree *st, int data);
+int shard_search(ShardedTree *st, int data);
+size_t shard_range(ShardedTree *st, int lo, int hi, int *out, size_t max);
+int shard_rebalance(ShardedTree *st);
+
+#endif /* SHARD_H */
@@ -0,0 +1,403 @@
+/***********************************************************************
+ *  File Name   : store.c
+ *  Description : Saving and loading trees in the binary format of
+ *                store.h. save_tree() writes preorder records in one
+ *                fwrite(); load_tree() maps the file and relinks the
+ *                exact saved shape and colors in O(n) without a single
+ *                rotation; map_tree() + mapped_search() serve lookups
+ *                straight from the page cache with no rebuild at all.
+ *
+ *                With RB_LAZY_DELETE, tombstones are never written: a
+ *                tree holding any is saved as the balanced tree that
+ *                rbtree_purge() would leave, so a load cannot revive a
+ *                deleted key.
+ *
+ *  Functions:
+ *      - count_nodes()
+ *      - fill_records()
+ *      - collect_live_keys()
+ *      - fill_balanced()
+ *      - snapshot_tree()
+ *      - save_records()
+ *      - save_tree()
+ *      - rebuild()
+ *      - load_tree()
+ *      - load_tree_pool()
+ *      - map_tree()
+ *      - mapped_search()
+ *      - unmap_tree()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "store.h"
+
+/* --------------------------------------------------------------------
+ * Helper Function: count_nodes()
+ * Description: Returns the number of nodes in a subtree.
+ * --------------------------------------------------------------------*/
+static size_t count_nodes(Tree *node)
+{
+    return node ? 1 + count_nodes(node->left) + count_nodes(node->right) : 0;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: fill_records()
+ * Description: Writes a subtree in preorder starting at records[*next];
+ *              the right-child distance is known once the left
+ *              subtree has been written.
+ * --------------------------------------------------------------------*/
+static void fill_records(Tree *node, TreeRecord *records, size_t *next)
+{
+    size_t self = (*next)++;
+
+    records[self].data = node->data;
+    records[self].link = (NODE_COLOR(node) == BLACK ? RECORD_COLOR : 0) |
+                         (node->left ? RECORD_HAS_LEFT : 0);
+
+    if (node->left)
+        fill_records(node->left, records, next);
+    if (node->right)
+    {
+        records[self].link |= (uint32_t)(*next - self) << 2;
+        fill_records(node->right, records, next);
+    }
+}
+
+#ifdef RB_LAZY_DELETE
+/* --------------------------------------------------------------------
+ * Helper Function: collect_live_keys()
+ * Description: Appends the live keys of a subtree, in order, to
+ *              keys[*n], skipping tombstones.
+ * --------------------------------------------------------------------*/
+static void collect_live_keys(Tree *node, int *keys, size_t *n)
+{
+    while (node)
+    {
+        collect_live_keys(node->left, keys, n);
+        if (!NODE_DEAD(node))
+            keys[(*n)++] = node->data;
+        node = node->right;
+    }
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: fill_balanced()
+ * Description: Writes keys[lo, hi) as the preorder records of a
+ *              perfectly balanced subtree, colored by depth as
+ *              rbtree_purge() colors it: only level @red_depth is RED.
+ * --------------------------------------------------------------------*/
+static void fill_balanced(const int *keys, size_t lo, size_t hi, int depth, int red_depth,
+                          TreeRecord *records, size_t *next)
+{
+    size_t mid = lo + (hi - lo) / 2, self = (*next)++;
+
+    records[self].data = keys[mid];
+    records[self].link = (depth == red_depth ? 0 : RECORD_COLOR) |
+                         (lo < mid ? RECORD_HAS_LEFT : 0);
+
+    if (lo < mid)
+        fill_balanced(keys, lo, mid, depth + 1, red_depth, records, next);
+    if (mid + 1 < hi)
+    {
+        records[self].link |= (uint32_t)(*next - self) << 2;
+        fill_balanced(keys, mid + 1, hi, depth + 1, red_depth, records, next);
+    }
+}
+#endif
+
+/* --------------------------------------------------------------------
+ * Function: snapshot_tree()
+ * Description: Copies the tree into a malloc'd array of preorder
+ *              records and stores their number in *count. This is the
+ *              only part of saving that reads the tree, so a tree
+ *              shared under a lock can be written out without it.
+ *              Tombstones are left out (RB_LAZY_DELETE): if there are
+ *              any, the live keys are laid out as a balanced tree.
+ *              Returns NULL if the tree exceeds STORE_MAX_NODES or
+ *              memory runs out.
+ * --------------------------------------------------------------------*/
+TreeRecord *snapshot_tree(Tree *root, size_t *count)
+{
+    size_t next = 0;
+
+    *count = count_nodes(root);
+    if (*count >= STORE_MAX_NODES)
+        return NULL;
+
+    TreeRecord *records = malloc(*count ? *count * sizeof(TreeRecord) : 1);
+    if (records == NULL || root == NULL)
+        return records;
+
+#ifdef RB_LAZY_DELETE
+    int *keys = malloc(*count * sizeof(int));
+    size_t live = 0;
+
+    if (keys == NULL)
+    {
+        free(records);
+        return NULL;
+    }
+    collect_live_keys(root, keys, &live);
+    if (live < *count)
+    {
+        // Levels 0 .. red_depth-1 are full; red_depth = floor(log2(n + 1))
+        int red_depth = 0;
+        for (size_t full = live + 1; full > 1; full >>= 1)
+            red_depth++;
+
+        if (live > 0)
+            fill_balanced(keys, 0, live, 0, red_depth, records, &next);
+        *count = live;
+        free(keys);
+        return records;
+    }
+    free(keys);
+#endif
+    fill_records(root, records, &next);
+    return records;
+}
+
+/* --------------------------------------------------------------------
+ * Function: save_records()
+ * Description: Writes @count records from snapshot_tree() to @path.
+ *              Returns FAILURE on I/O errors.
+ * --------------------------------------------------------------------*/
+int save_records(const TreeRecord *records, size_t count, const char *path)
+{
+    TreeFileHeader header = { { 'R', 'B', 'T', '1' }, STORE_BYTE_ORDER, count };
+    FILE *fp = fopen(path, "wb");
+    int flag = FAILURE;
+
+    if (fp)
+    {
+        if (fwrite(&header, sizeof(header), 1, fp) == 1 &&
+            fwrite(records, sizeof(TreeRecord), count, fp) == count)
+            flag = SUCCESS;
+        if (fclose(fp) != 0)
+            flag = FAILURE;
+    }
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Function: save_tree()
+ * Description: Writes the tree to @path, without its tombstones (see
+ *              snapshot_tree()). Returns FAILURE on I/O errors or if
+ *              the tree exceeds STORE_MAX_NODES.
+ * --------------------------------------------------------------------*/
+int save_tree(Tree *root, const char *path)
+{
+    size_t count;
+    TreeRecord *records = snapshot_tree(root, &count);
+
+    if (records == NULL)
+        return FAILURE;
+
+    int flag = save_records(records, count, path);
+    free(records);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: rebuild()
+ * Description: Recreates the tree stored in records[0, count) into
+ *              *root. Iterative: right subtrees wait on a fixed
+ *              RB_MAX_HEIGHT stack while the left spine is built. Every
+ *              subtree must exactly fill the record range its parent
+ *              gives it, and a tree deeper than RB_MAX_HEIGHT (no valid
+ *              Red-Black Tree is) is rejected, so a corrupt file can
+ *              neither loop nor exhaust memory or the stack. On FAILURE
+ *              the partial tree is freed and *root left NULL.
+ * --------------------------------------------------------------------*/
+static int rebuild(const TreeRecord *records, size_t count, Tree **root, NodePool *pool)
+{
+    struct
+    {
+        Tree *parent;
+        size_t start, end;
+        int depth;
+    } pending[RB_MAX_HEIGHT];
+    Tree *parent = NULL, **link = root;
+    size_t start = 0, end = count;
+    int top = 0, depth = 1;
+
+    *root = NULL;
+    for (;;)
+    {
+        // Subtree records[start, end) hangs from *link at @depth
+        const TreeRecord *rec = &records[start];
+        size_t right = RECORD_RIGHT(rec) ? start + RECORD_RIGHT(rec) : end;
+        int has_left = (rec->link & RECORD_HAS_LEFT) != 0;
+
+        if (depth > RB_MAX_HEIGHT || right > end || (RECORD_RIGHT(rec) && right == end) ||
+            (has_left ? start + 1 >= right : right != start + 1))
+            break;
+
+        Tree *node = create_node_pool(rec->data, pool);
+        if (node == NULL)
+            break;
+        SET_PARENT(node, parent);
+        SET_COLOR(node, (rec->link & RECORD_COLOR) ? BLACK : RED);
+#ifdef RB_ORDER_STATS
+        node->size = (unsigned int)(end - start);
+#endif
+        *link = node;
+
+        if (RECORD_RIGHT(rec))
+        {
+            pending[top].parent = node;
+            pending[top].start = right;
+            pending[top].end = end;
+            pending[top++].depth = depth + 1;
+        }
+
+        if (has_left)
+        {
+            parent = node;
+            link = &node->left;
+            start++;
+            end = right;
+            depth++;
+        }
+        else if (top > 0)
+        {
+            top--;
+            parent = pending[top].parent;
+            link = &parent->right;
+            start = pending[top].start;
+            end = pending[top].end;
+            depth = pending[top].depth;
+        }
+        else
+            return SUCCESS;
+    }
+
+    delete_tree_pool(root, pool);
+    return FAILURE;
+}
+
+/* --------------------------------------------------------------------
+ * Function: load_tree()
+ * Description: Rebuilds a saved tree into *root (which should be
+ *              empty) with malloc'd nodes.
+ * --------------------------------------------------------------------*/
+int load_tree(const char *path, Tree **root)
+{
+    return load_tree_pool(path, root, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: load_tree_pool()
+ * Description: Same as load_tree(), taking nodes from @pool.
+ * --------------------------------------------------------------------*/
+int load_tree_pool(const char *path, Tree **root, NodePool *pool)
+{
+    MappedTree map;
+    int status = SUCCESS;
+
+    if (map_tree(path, &map) != SUCCESS)
+        return FAILURE;
+
+    *root = NULL;
+    if (map.count)
+        status = rebuild(map.records, map.count, root, pool);
+#ifdef RB_THREADED
+    thread_tree(*root);
+#endif
+    unmap_tree(&map);
+    return status;
+}
+
+/* --------------------------------------------------------------------
+ * Function: map_tree()
+ * Description: Maps a saved tree read-only after checking its header
+ *              and length. Searching it needs no rebuild.
+ * --------------------------------------------------------------------*/
+int map_tree(const char *path, MappedTree *map)
+{
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return FAILURE;
+
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(TreeFileHeader))
+    {
+        close(fd);
+        return FAILURE;
+    }
+
+    map->length = (size_t)st.st_size;
+    map->base = mmap(NULL, map->length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map->base == MAP_FAILED)
+        return FAILURE;
+
+    const TreeFileHeader *header = map->base;
+    if (memcmp(header->magic, STORE_MAGIC, 4) != 0 ||
+        header->byte_order != STORE_BYTE_ORDER ||
+        header->count >= STORE_MAX_NODES ||
+        map->length != sizeof(TreeFileHeader) + header->count * sizeof(TreeRecord))
+    {
+        munmap(map->base, map->length);
+        return FAILURE;
+    }
+
+    map->records = (const TreeRecord *)(header + 1);
+    map->count = (size_t)header->count;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: mapped_search()
+ * Description: Searches a mapped file in place. Every step moves to a
+ *              later record, so even a corrupt file terminates.
+ * --------------------------------------------------------------------*/
+int mapped_search(const MappedTree *map, int data)
+{
+    size_t i = 0;
+
+    while (i < map->count)
+    {
+        const TreeRecord *rec = &map->records[i];
+
+        if (rec->data == data)
+            return SUCCESS;
+        if (data < rec->data)
+        {
+            if (!(rec->link & RECORD_HAS_LEFT))
+                break;
+            i++;
+        }
+        else
+        {
+            if (RECORD_RIGHT(rec) == 0)
+                break;
+            i += RECORD_RIGHT(rec);
+        }
+    }
+    return DATA_NOT_FOUND;
+}
+
+/* --------------------------------------------------------------------
+ * Function: unmap_tree()
+ * Description: Releases a mapping made by map_tree().
+ * --------------------------------------------------------------------*/
+int unmap_tree(MappedTree *map)
+{
+    if (map == NULL || map->base == NULL)
+        return FAILURE;
+
+    munmap(map->base, map->length);
+    map->base = NULL;
+    map->records = NULL;
+    map->count = 0;
+    return SUCCESS;
+}
@@ -0,0 +1,90 @@
+/***********************************************************************
+ *  File Name   : store.h
+ *  Description : Header file for the binary on-disk tree format.
+ *
+ *                File layout (native byte order):
+ *                  TreeFileHeader, then one 8-byte TreeRecord per node
+ *                  in preorder. A node's left child, if any, is the
+ *                  next record; its right child sits @right records
+ *                  further on. Shape and colors are stored exactly, so
+ *                  loading rebuilds the tree in O(n) with no fixups,
+ *                  and a mapped file can be searched in place.
+ *
+ *  Functions:
+ *                - save_tree()                  : Write a tree to a file
+ *                - snapshot_tree() / save_records(): The same in two steps
+ *                - load_tree() / load_tree_pool(): Rebuild a tree from a file
+ *                - map_tree() / unmap_tree()    : mmap a file read-only
+ *                - mapped_search()              : Search a mapped file
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef STORE_H
+#define STORE_H
+
+#include "tree.h"
+
+/*--------------------------------------------------------------
+ *                      FILE FORMAT MACROS
+ *-------------------------------------------------------------*/
+#define STORE_MAGIC "RBT1"
+#define STORE_BYTE_ORDER 0x01020304u   // reads back differently on a foreign-endian host
+#define STORE_MAX_NODES (1u << 30)     // right offsets keep 30 bits
+
+#define RECORD_COLOR 0x1u              // BLACK when set
+#define RECORD_HAS_LEFT 0x2u
+#define RECORD_RIGHT(r) ((r)->link >> 2)
+
+/**
+ * struct TreeFileHeader - Start of a saved tree file
+ * @magic      : STORE_MAGIC
+ * @byte_order : STORE_BYTE_ORDER as written by the saving host
+ * @count      : Number of node records that follow
+ */
+typedef struct TreeFileHeader
+{
+    char magic[4];
+    uint32_t byte_order;
+    uint64_t count;
+} TreeFileHeader;
+
+/**
+ * struct TreeRecord - One node of a saved tree
+ * @data : Key stored in the node
+ * @link : Right-child distance in records << 2 (0 = none),
+ *         RECORD_HAS_LEFT and RECORD_COLOR bits
+ */
+typedef struct TreeRecord
+{
+    int32_t data;
+    uint32_t link;
+} TreeRecord;
+
+/**
+ * struct MappedTree - A saved tree mapped read-only into memory
+ * @base    : Start of the mapping
+ * @length  : Size of the mapping in bytes
+ * @records : Node records (preorder)
+ * @count   : Number of records
+ */
+typedef struct MappedTree
+{
+    void *base;
+    size_t length;
+    const TreeRecord *records;
+    size_t count;
+} MappedTree;
+
+int save_tree(Tree *root, const char *path);
+TreeRecord *snapshot_tree(Tree *root, size_t *count);
+int save_records(const TreeRecord *records, size_t count, const char *path);
+int load_tree(const char *path, Tree **root);
+int load_tree_pool(const char *path, Tree **root, NodePool *pool);
+int map_tree(const char *path, MappedTree *map);
+int mapped_search(const MappedTree *map, int data);
+int unmap_tree(MappedTree *map);
+
+#endif /* STORE_H */
@@ -0,0 +1,155 @@
+/***********************************************************************
+ *  File Name   : test.h
+ *  Description : Minimal harness shared by the regression tests.
+ *                Every tests/test_*.c is a program of its own, linked
+ *                against all library objects by "make test". CHECK()
+ *                records a failed condition with its location and
+ *                carries on; main() ends with test_done(), whose exit
+ *                status stops "make test" at the first failing program.
+ *
+ *                check_tree() verifies the invariants every tree must
+ *                keep under the current FEATURES: Red-Black coloring,
+ *                parent links, strict key order, and, when built in,
+ *                subtree sizes (RB_ORDER_STATS) and in-order threads
+ *                (RB_THREADED).
+ *
+ *  Functions:
+ *                - CHECK()        : Record a failed condition
+ *                - check_tree()   : Validate a whole tree
+ *                - test_path()    : Per-process scratch file name
+ *                - test_done()    : Print the summary, return exit code
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "../tree.h"
+
+static int test_checks, test_failures;
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        test_checks++;                                                  \
+        if (!(cond))                                                    \
+        {                                                               \
+            test_failures++;                                            \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n",                \
+                    __FILE__, __LINE__, #cond);                         \
+        }                                                               \
+    } while (0)
+
+/* --------------------------------------------------------------------
+ * Helper Function: check_subtree()
+ * Description: Checks @node's subtree against its parent link, the
+ *              open key range (@lo, @hi) and the coloring rules; adds
+ *              its nodes to *count. Returns its black height, or -1.
+ * --------------------------------------------------------------------*/
+static inline int check_subtree(Tree *node, Tree *parent, long lo, long hi, size_t *count)
+{
+    if (node == NULL)
+        return 1;
+
+    if (NODE_PARENT(node) != parent || node->data <= lo || node->data >= hi)
+        return -1;
+    if (NODE_COLOR(node) == RED &&
+        ((node->left && NODE_COLOR(node->left) == RED) ||
+         (node->right && NODE_COLOR(node->right) == RED)))
+        return -1;
+
+    size_t before = (*count)++;
+    int hl = check_subtree(node->left, node, lo, node->data, count);
+    int hr = check_subtree(node->right, node, node->data, hi, count);
+    if (hl < 0 || hl != hr)
+        return -1;
+#ifdef RB_ORDER_STATS
+    if (node->size != *count - before)
+        return -1;
+#else
+    (void)before;
+#endif
+    return hl + (NODE_COLOR(node) == BLACK);
+}
+
+#ifdef RB_THREADED
+/* --------------------------------------------------------------------
+ * Helper Function: check_threads()
+ * Description: Walks the subtree in order, checking that each node's
+ *              prev/next links match its in-order neighbours. *last
+ *              carries the previously visited node.
+ * --------------------------------------------------------------------*/
+static inline int check_threads(Tree *node, Tree **last)
+{
+    if (node == NULL)
+        return SUCCESS;
+    if (check_threads(node->left, last) != SUCCESS)
+        return FAILURE;
+    if (node->prev != *last || (*last && (*last)->next != node))
+        return FAILURE;
+    *last = node;
+    return check_threads(node->right, last);
+}
+#endif
+
+/* --------------------------------------------------------------------
+ * Function: check_tree()
+ * Description: Returns SUCCESS if the whole tree is a valid Red-Black
+ *              Tree under the current FEATURES, storing its number of
+ *              nodes (tombstones included) in *count if non-NULL.
+ * --------------------------------------------------------------------*/
+static inline int check_tree(Tree *root, size_t *count)
+{
+    size_t n = 0;
+
+    if (count)
+        *count = 0;
+    if (root && NODE_COLOR(root) != BLACK)
+        return FAILURE;
+    if (check_subtree(root, NULL, (long)INT_MIN - 1, (long)INT_MAX + 1, &n) < 0)
+        return FAILURE;
+#ifdef RB_THREADED
+    Tree *last = NULL;
+    if (check_threads(root, &last) != SUCCESS || (last && last->next))
+        return FAILURE;
+#endif
+    if (count)
+        *count = n;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: test_path()
+ * Description: Writes a scratch file name unique to this process and
+ *              @tag into @buf.
+ * --------------------------------------------------------------------*/
+static inline const char *test_path(char *buf, size_t size, const char *tag)
+{
+    snprintf(buf, size, "/tmp/rbtree_test_%s_%d", tag, (int)getpid());
+    return buf;
+}
+
+/* --------------------------------------------------------------------
+ * Function: test_done()
+ * Description: Prints the summary line for program @name and returns
+ *              its exit status.
+ * --------------------------------------------------------------------*/
+static inline int test_done(const char *name)
+{
+    if (test_failures)
+    {
+        printf("%s: %d of %d checks FAILED\n", name, test_failures, test_checks);
+        return EXIT_FAILURE;
+    }
+    printf("%s: %d checks passed\n", name, test_checks);
+    return EXIT_SUCCESS;
+}
+
+#endif /* TEST_H */
@@ -0,0 +1,181 @@
+/***********************************************************************
+ *  File Name   : test_batch.c
+ *  Description : Regression tests for batch mode (batch.c): text and
+ *                binary streams, malformed lines and records, input
+ *                spanning many read chunks, and over-long lines, which
+ *                must cost exactly one error.
+ *
+ *  Functions:
+ *      - replay()
+ *      - test_text()
+ *      - test_errors()
+ *      - test_binary()
+ *      - test_chunks()
+ *      - test_long_line()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../batch.h"
+
+#define LINES 300000
+
+/* --------------------------------------------------------------------
+ * Helper Function: replay()
+ * Description: Runs run_batch() on @len bytes of @input with stdout
+ *              sent to a scratch file, and reads the printed summary
+ *              back into *sum. Returns run_batch()'s status, or
+ *              DATA_NOT_FOUND if the summary could not be read.
+ * --------------------------------------------------------------------*/
+static int replay(const char *input, size_t len, BatchSummary *sum, int *binary)
+{
+    char in_path[64], out_path[64], line[128], kind[16] = "";
+    int status, saved, lines = 0;
+
+    memset(sum, 0, sizeof(*sum));
+    FILE *in = fopen(test_path(in_path, sizeof(in_path), "batch_in"), "w+");
+    FILE *out = fopen(test_path(out_path, sizeof(out_path), "batch_out"), "w+");
+    if (in == NULL || out == NULL || fwrite(input, 1, len, in) != len)
+        return DATA_NOT_FOUND;
+    rewind(in);
+
+    fflush(stdout);
+    saved = dup(STDOUT_FILENO);
+    dup2(fileno(out), STDOUT_FILENO);
+    status = run_batch(in);
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+
+    rewind(out);
+    while (fgets(line, sizeof(line), out))
+        lines += sscanf(line, "ops : %*u (%15s", kind) == 1 ||
+                 sscanf(line, "insert : %lu inserted, %lu", &sum->inserted, &sum->duplicates) == 2 ||
+                 sscanf(line, "search : %lu found, %lu", &sum->found, &sum->missing) == 2 ||
+                 sscanf(line, "delete : %lu deleted, %lu", &sum->deleted, &sum->not_deleted) == 2 ||
+                 sscanf(line, "errors : %lu", &sum->errors) == 1;
+    *binary = strcmp(kind, "binary") == 0;
+    fclose(in);
+    fclose(out);
+    remove(in_path);
+    remove(out_path);
+    return lines == 5 ? status : DATA_NOT_FOUND;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_text()
+ * Description: Every op and outcome, comments, blank lines, CRLF and
+ *              a last line without its newline.
+ * --------------------------------------------------------------------*/
+static void test_text(void)
+{
+    static const char input[] = "I 5\nI 3\nI 5\n# comment\n\n  S 3\nS 9\n"
+                                "D 3\nD 3\nI -7\r\nS\t-7";
+    BatchSummary sum;
+    int binary;
+
+    CHECK(replay(input, sizeof(input) - 1, &sum, &binary) == SUCCESS && !binary);
+    CHECK(sum.inserted == 3 && sum.duplicates == 1);
+    CHECK(sum.found == 2 && sum.missing == 1);
+    CHECK(sum.deleted == 1 && sum.not_deleted == 1);
+    CHECK(sum.errors == 0);
+    CHECK(replay("", 0, &sum, &binary) == SUCCESS && sum.inserted == 0);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_errors()
+ * Description: Trailing junk, a missing or out-of-range number and an
+ *              unknown op are errors; the extreme ints are not.
+ * --------------------------------------------------------------------*/
+static void test_errors(void)
+{
+    static const char input[] = "I 5abc\nI\nI 2147483648\nI -2147483649\nX 4\n"
+                                "I 2147483647\nI -2147483648\n";
+    BatchSummary sum;
+    int binary;
+
+    CHECK(replay(input, sizeof(input) - 1, &sum, &binary) == FAILURE);
+    CHECK(sum.errors == 5 && sum.inserted == 2);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_binary()
+ * Description: Little-endian keys, INT_MIN included; a truncated last
+ *              record is one error.
+ * --------------------------------------------------------------------*/
+static void test_binary(void)
+{
+    static const char input[] = BATCH_MAGIC "I\1\0\0\0" "I\0\0\0\x80" "S\1\0\0\0"
+                                "S\0\0\0\x80" "D\1\0\0\0" "S\1\0\0\0" "I\2";
+    BatchSummary sum;
+    int binary;
+
+    CHECK(replay(input, sizeof(input) - 1, &sum, &binary) == FAILURE && binary);
+    CHECK(sum.inserted == 2 && sum.found == 2 && sum.deleted == 1 && sum.missing == 1);
+    CHECK(sum.errors == 1);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_chunks()
+ * Description: Text and binary streams over a megabyte, so lines and
+ *              records straddle read chunks.
+ * --------------------------------------------------------------------*/
+static void test_chunks(void)
+{
+    size_t size = strlen(BATCH_MAGIC) + (size_t)LINES * 16, len = 0;
+    char *input = malloc(size);
+    BatchSummary sum;
+    int binary;
+
+    for (int i = 0; i < LINES; i++)
+        len += (size_t)sprintf(input + len, "I %d\n", i * 3);
+    CHECK(replay(input, len, &sum, &binary) == SUCCESS);
+    CHECK(sum.inserted == LINES && sum.errors == 0);
+
+    len = strlen(BATCH_MAGIC);
+    memcpy(input, BATCH_MAGIC, len);
+    for (int i = 0; i < LINES; i++, len += BATCH_RECORD)
+    {
+        unsigned int key = (unsigned int)i * 3;
+        input[len] = (i % 4 == 3) ? 'S' : 'I';
+        for (int b = 0; b < 4; b++)
+            input[len + 1 + b] = (char)(key >> (8 * b));
+    }
+    CHECK(replay(input, len, &sum, &binary) == SUCCESS && binary);
+    CHECK(sum.inserted == LINES - LINES / 4 && sum.missing == LINES / 4 && sum.errors == 0);
+    free(input);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_long_line()
+ * Description: A line over two read chunks long is one error, and the
+ *              ops around it still run.
+ * --------------------------------------------------------------------*/
+static void test_long_line(void)
+{
+    size_t digits = 2 * BATCH_BUF_SIZE + 100, len = 0;
+    char *input = malloc(digits + 32);
+    BatchSummary sum;
+    int binary;
+
+    len += (size_t)sprintf(input, "I 1\nI ");
+    memset(input + len, '1', digits);
+    len += digits;
+    len += (size_t)sprintf(input + len, "\nI 2\nS 2\n");
+    CHECK(replay(input, len, &sum, &binary) == FAILURE);
+    CHECK(sum.inserted == 2 && sum.found == 1 && sum.errors == 1);
+    free(input);
+}
+
+int main(void)
+{
+    test_text();
+    test_errors();
+    test_binary();
+    test_chunks();
+    test_long_line();
+    return test_done("test_batch");
+}
@@ -0,0 +1,121 @@
+/***********************************************************************
+ *  File Name   : test_bench.c
+ *  Description : Regression tests for the benchmark driver
+ *                (bench/bench.c), compiled in with its main() renamed:
+ *                the key and Zipfian generators it relies on, and a
+ *                small full run whose CSV every workload must complete.
+ *
+ *  Functions:
+ *      - test_generators()
+ *      - test_small_run()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+
+#define main bench_main
+#include "../bench/bench.c"
+#undef main
+
+#define KEYS 100000
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_generators()
+ * Description: KEY() gives distinct keys, so the insert workloads
+ *              never hit a duplicate; Zipfian ranks stay in range and
+ *              favour rank 0.
+ * --------------------------------------------------------------------*/
+static void test_generators(void)
+{
+    static long keys[KEYS];
+    static size_t hits[MIN_SIZE];
+    Bench b = { DEFAULT_SEED, NULL, 0, 1 };
+    Zipf zipf;
+    size_t wrong = 0;
+
+    for (size_t i = 0; i < KEYS; i++)
+        keys[i] = KEY(i);
+    qsort(keys, KEYS, sizeof(long), compare_long);
+    for (size_t i = 1; i < KEYS; i++)
+        wrong += keys[i] == keys[i - 1];
+    CHECK(wrong == 0);
+
+    zipf_init(&zipf, MIN_SIZE, ZIPF_THETA);
+    for (int i = 0; i < 100000; i++)
+    {
+        size_t rank = zipf_next(&zipf, &b);
+        if (rank >= MIN_SIZE)
+            wrong++;
+        else
+            hits[rank]++;
+    }
+    CHECK(wrong == 0);
+    CHECK(hits[0] > hits[1] && hits[1] > hits[MIN_SIZE / 2]);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_small_run()
+ * Description: Runs the suite at MIN_SIZE in a child with stdout and
+ *              stderr sent to files; every row must have the header's
+ *              columns and a nonzero rate, and no workload may fail.
+ * --------------------------------------------------------------------*/
+static void test_small_run(void)
+{
+    char out_path[64], err_path[64], line[512];
+    char *args[] = { "rbtree_bench", "1000", NULL };
+    int status, rows = 0, bad = 0, columns = -1;
+
+    test_path(out_path, sizeof(out_path), "bench_out");
+    test_path(err_path, sizeof(err_path), "bench_err");
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        if (freopen(out_path, "w", stdout) == NULL || freopen(err_path, "w", stderr) == NULL)
+            _exit(EXIT_FAILURE);
+        exit(bench_main(2, args));
+    }
+    CHECK(pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) &&
+          WEXITSTATUS(status) == EXIT_SUCCESS);
+
+    FILE *fp = fopen(out_path, "r");
+    while (fp && fgets(line, sizeof(line), fp))
+    {
+        int fields = 1;
+        for (char *c = line; *c; c++)
+            fields += *c == ',';
+        if (columns < 0)
+        {
+            columns = fields;
+            continue;
+        }
+        char *rate = line;
+        for (int i = 0; i < 4 && rate; i++)
+            rate = strchr(rate + 1, ',');
+        bad += fields != columns || rate == NULL || atof(rate + 1) <= 0;
+        rows++;
+    }
+    if (fp)
+        fclose(fp);
+    CHECK(columns == 9 || columns == 17);
+    CHECK(rows >= 18 && bad == 0);
+
+    fp = fopen(err_path, "r");
+    while (fp && fgets(line, sizeof(line), fp))
+        bad += strstr(line, "failed") != NULL;
+    if (fp)
+        fclose(fp);
+    CHECK(bad == 0);
+    remove(out_path);
+    remove(err_path);
+}
+
+int main(void)
+{
+    test_generators();
+    test_small_run();
+    return test_done("test_bench");
+}
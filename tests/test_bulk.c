@@ -0,0 +1,103 @@
+/***********************************************************************
+ *  File Name   : test_bulk.c
+ *  Description : Regression tests for bulk loading (bulk.c).
+ *
+ *  Functions:
+ *      - test_build_from_sorted()
+ *      - test_insert_batch()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+
+#define N 5000
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_build_from_sorted()
+ * Description: Every size up to a few full levels builds a valid tree
+ *              holding exactly the keys; bad input is rejected.
+ * --------------------------------------------------------------------*/
+static void test_build_from_sorted(void)
+{
+    static int keys[N];
+    int invalid = 0, wrong = 0;
+    size_t count;
+    NodePool pool;
+
+    for (int i = 0; i < N; i++)
+        keys[i] = 3 * i - N;
+
+    for (size_t n = 1; n <= 70; n++)
+    {
+        Tree *root = build_from_sorted(keys, n);
+        invalid += check_tree(root, &count) != SUCCESS || count != n;
+        delete_tree(&root);
+    }
+    CHECK(invalid == 0);
+
+    pool_init(&pool, 0);
+    Tree *root = build_from_sorted_pool(keys, N, &pool);
+    CHECK(check_tree(root, &count) == SUCCESS && count == N);
+    for (int i = 0; i < N; i++)
+        wrong += search_node(root, keys[i]) != SUCCESS || search_node(root, keys[i] + 1) == SUCCESS;
+    CHECK(wrong == 0);
+    CHECK(insert_node_pool(&root, keys[N - 1] + 1, &pool) == SUCCESS);
+    CHECK(check_tree(root, NULL) == SUCCESS);
+    pool_destroy(&pool, &root);
+
+    CHECK(build_from_sorted(keys, 0) == NULL);
+    CHECK(build_from_sorted(NULL, 3) == NULL);
+    keys[10] = keys[9];
+    CHECK(build_from_sorted(keys, N) == NULL);      // duplicate
+    keys[10] = keys[8];
+    CHECK(build_from_sorted(keys, N) == NULL);      // out of order
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_insert_batch()
+ * Description: Unsorted batches with repeats, into empty and populated
+ *              trees: per-key statuses come back in the caller's
+ *              order, and the first occurrence of a key wins.
+ * --------------------------------------------------------------------*/
+static void test_insert_batch(void)
+{
+    static int keys[N], status[N];
+    Tree *root = NULL;
+    int wrong = 0;
+    size_t count;
+
+    for (int i = 0; i < N; i++)
+        keys[i] = (int)((i * 7919L) % (N / 2));     // every key twice
+    CHECK(insert_batch(&root, keys, N, status) == SUCCESS);
+    for (int i = 0; i < N; i++)
+        wrong += status[i] != (i < N / 2 ? SUCCESS : DUPLICATE);
+    CHECK(wrong == 0);
+    CHECK(check_tree(root, &count) == SUCCESS && count == N / 2);
+
+    // Interleave with what is already there; no status array wanted
+    for (int i = 0; i < N; i++)
+        keys[i] = N - 2 * i;
+    CHECK(insert_batch(&root, keys, N, NULL) == SUCCESS);
+    CHECK(check_tree(root, &count) == SUCCESS);
+    for (int i = 0; i < N; i++)
+        wrong += search_node(root, keys[i]) != SUCCESS;
+    CHECK(wrong == 0);
+    delete_tree(&root);
+
+    NodePool pool;
+    pool_init(&pool, 0);
+    CHECK(insert_batch_pool(&root, keys, 0, status, &pool) == SUCCESS && root == NULL);
+    CHECK(insert_batch_pool(&root, keys, N, status, &pool) == SUCCESS);
+    CHECK(check_tree(root, &count) == SUCCESS && count == N);
+    pool_destroy(&pool, &root);
+}
+
+int main(void)
+{
+    test_build_from_sorted();
+    test_insert_batch();
+    return test_done("test_bulk");
+}
@@ -0,0 +1,194 @@
+/***********************************************************************
+ *  File Name   : test_compact.c
+ *  Description : Regression tests for tree compaction (compact.c):
+ *                the tree keeps its exact shape and colors, lands in
+ *                BFS order in one block, stays valid between bounded
+ *                steps, and an RBTree's cached min/max and pool follow
+ *                the moved nodes.
+ *
+ *  Functions:
+ *      - same_shape()
+ *      - churned_tree()
+ *      - test_compact_tree()
+ *      - test_steps()
+ *      - test_rbtree()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../compact.h"
+
+#define KEYS 4000
+
+/* --------------------------------------------------------------------
+ * Helper Function: same_shape()
+ * Description: Returns 1 if both subtrees have the same shape, keys
+ *              and colors.
+ * --------------------------------------------------------------------*/
+static int same_shape(Tree *a, Tree *b)
+{
+    if (a == NULL || b == NULL)
+        return a == b;
+    return a->data == b->data && NODE_COLOR(a) == NODE_COLOR(b) &&
+           same_shape(a->left, b->left) && same_shape(a->right, b->right);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: churned_tree()
+ * Description: Builds the same tree of random inserts and deletes
+ *              every time (from @pool, or malloc'd if NULL).
+ * --------------------------------------------------------------------*/
+static Tree *churned_tree(NodePool *pool)
+{
+    Tree *root = NULL;
+
+    srand(20);
+    for (int i = 0; i < 3 * KEYS; i++)
+    {
+        int key = rand() % KEYS;
+        if (rand() % 3)
+            insert_node_pool(&root, key, pool);
+        else
+            delete_node_pool(&root, key, pool);
+    }
+    return root;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_compact_tree()
+ * Description: One-shot compaction of malloc'd and pooled trees: same
+ *              shape as an uncompacted twin, nodes in BFS order in the
+ *              block, and the tree still takes inserts and deletes.
+ * --------------------------------------------------------------------*/
+static void test_compact_tree(void)
+{
+    static Tree *queue[KEYS];
+    Tree *root = churned_tree(NULL), *twin = churned_tree(NULL), *empty = NULL;
+    NodePool pool, old_pool, spare;
+    size_t count, head = 0, tail = 0;
+    int wrong = 0;
+
+    CHECK(compact_tree(&root, NULL, NULL) == FAILURE);
+    CHECK(compact_tree(&root, NULL, &pool) == SUCCESS);
+    CHECK(check_tree(root, &count) == SUCCESS && same_shape(root, twin));
+
+    // Level order walks the block front to back
+    queue[tail++] = root;
+    while (head < tail)
+    {
+        Tree *node = queue[head];
+        wrong += node != &pool.slabs->nodes[head];
+        head++;
+        if (node->left)
+            queue[tail++] = node->left;
+        if (node->right)
+            queue[tail++] = node->right;
+    }
+    CHECK(wrong == 0 && head == count);
+
+    for (int key = 0; key < KEYS; key++)
+        if (key % 2)
+            insert_node_pool(&root, key, &pool);
+        else
+            delete_node_pool(&root, key, &pool);
+    CHECK(check_tree(root, &count) == SUCCESS && count == KEYS / 2);
+    pool_destroy(&pool, &root);
+    delete_tree(&twin);
+
+    // From one pool into another; the old one only holds free nodes after
+    pool_init(&old_pool, 0);
+    root = churned_tree(&old_pool);
+    twin = churned_tree(NULL);
+    CHECK(compact_tree(&root, &old_pool, &old_pool) == FAILURE);
+    CHECK(compact_tree(&root, &old_pool, &pool) == SUCCESS && same_shape(root, twin));
+    pool_destroy(&old_pool, NULL);
+    CHECK(check_tree(root, NULL) == SUCCESS);
+    pool_destroy(&pool, &root);
+    delete_tree(&twin);
+
+    CHECK(compact_tree(&empty, NULL, &spare) == SUCCESS && empty == NULL);
+    pool_destroy(&spare, &empty);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_steps()
+ * Description: Small budgets: the tree must search and validate
+ *              between every step, and the steps must add up.
+ * --------------------------------------------------------------------*/
+static void test_steps(void)
+{
+    Tree *root = churned_tree(NULL), *twin = churned_tree(NULL);
+    NodePool pool;
+    Compactor c;
+    size_t count, left, steps = 0;
+    int invalid = 0;
+
+    check_tree(root, &count);
+    CHECK(compact_begin(&c, &root, NULL, &pool) == SUCCESS && c.total == count);
+    do
+    {
+        left = compact_step(&c, 37);
+        invalid += check_tree(root, NULL) != SUCCESS || !same_shape(root, twin) ||
+                   search_node(root, twin->data) != SUCCESS;
+        steps++;
+    } while (left > 0);
+    CHECK(invalid == 0);
+    CHECK(steps == (count + 36) / 37 && compact_step(&c, 37) == 0);
+    pool_destroy(&pool, &root);
+    delete_tree(&twin);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_rbtree()
+ * Description: The cached min/max follow their nodes between steps,
+ *              so pops work mid-compaction, and the handle takes the
+ *              new pool at the end.
+ * --------------------------------------------------------------------*/
+static void test_rbtree(void)
+{
+    RBTree tree;
+    NodePool pool;
+    Compactor c;
+    int min, max, wrong = 0, next_min = 0, next_max = KEYS - 1;
+
+    rbtree_init(&tree, NULL);
+    for (int i = 0; i < KEYS; i++)
+        rbtree_insert(&tree, (int)((i * 7919L) % KEYS), NULL);
+
+    CHECK(rbtree_compact_begin(&c, &tree, &pool) == SUCCESS);
+    while (compact_step(&c, 50) > 0)
+    {
+        // Peeking reads the cached nodes; the tree is not changed mid-step
+        wrong += rbtree_peek_min(&tree, &min) != SUCCESS || min != next_min;
+        wrong += rbtree_peek_max(&tree, &max) != SUCCESS || max != next_max;
+    }
+    CHECK(wrong == 0);
+    CHECK(tree.pool == &pool && tree.count == KEYS);
+
+    for (; next_min < next_max; next_min++, next_max--)
+    {
+        wrong += rbtree_pop_min(&tree, &min) != SUCCESS || min != next_min;
+        wrong += rbtree_pop_max(&tree, &max) != SUCCESS || max != next_max;
+    }
+    CHECK(wrong == 0 && tree.count == 0 && tree.root == NULL);
+    rbtree_destroy(&tree);
+
+    rbtree_init(&tree, NULL);
+    for (int i = 0; i < 100; i++)
+        rbtree_insert(&tree, i, NULL);
+    CHECK(rbtree_compact(&tree, &pool) == SUCCESS);
+    CHECK(rbtree_peek_min(&tree, &min) == SUCCESS && min == 0 && tree.min == findmin(tree.root));
+    CHECK(rbtree_peek_max(&tree, &max) == SUCCESS && max == 99 && tree.max->right == NULL);
+    rbtree_destroy(&tree);
+}
+
+int main(void)
+{
+    test_compact_tree();
+    test_steps();
+    test_rbtree();
+    return test_done("test_compact");
+}
@@ -0,0 +1,127 @@
+/***********************************************************************
+ *  File Name   : test_ctree.c
+ *  Description : Regression tests for the compact node layouts: the
+ *                16-byte index tree (ctree.c) and, when built with
+ *                RB_PACKED_COLOR, the size of the packed struct Tree.
+ *
+ *  Functions:
+ *      - check_cnode()
+ *      - test_layouts()
+ *      - test_ctree_random()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../ctree.h"
+
+#define KEYS 3000
+#define OPS 60000
+
+/* --------------------------------------------------------------------
+ * Helper Function: check_cnode()
+ * Description: Validates the subtree at index @node like check_tree()
+ *              does a Tree, counting its nodes in *count. Returns its
+ *              black height, or -1.
+ * --------------------------------------------------------------------*/
+static int check_cnode(const CTree *tree, uint32_t node, uint32_t parent,
+                       long lo, long hi, size_t *count)
+{
+    if (node == CNIL)
+        return 1;
+
+    const CNode *n = &tree->nodes[node];
+    if (CNODE_PARENT(tree, node) != parent || n->data <= lo || n->data >= hi)
+        return -1;
+    if (CNODE_COLOR(tree, node) == RED &&
+        ((n->left != CNIL && CNODE_COLOR(tree, n->left) == RED) ||
+         (n->right != CNIL && CNODE_COLOR(tree, n->right) == RED)))
+        return -1;
+
+    (*count)++;
+    int hl = check_cnode(tree, n->left, node, lo, n->data, count);
+    int hr = check_cnode(tree, n->right, node, n->data, hi, count);
+    return (hl < 0 || hl != hr) ? -1 : hl + (CNODE_COLOR(tree, node) == BLACK);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_layouts()
+ * Description: The node sizes the layouts promise on 64-bit targets.
+ * --------------------------------------------------------------------*/
+static void test_layouts(void)
+{
+    CHECK(sizeof(CNode) == 16);
+#if defined(RB_PACKED_COLOR) && defined(RB_ORDER_STATS) && !defined(RB_THREADED)
+    if (sizeof(void *) == 8)
+        CHECK(sizeof(Tree) == 32);
+#endif
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_ctree_random()
+ * Description: Random inserts and deletes from a small initial
+ *              capacity, so the array grows, against a reference
+ *              table; freed slots are reused before the array grows.
+ * --------------------------------------------------------------------*/
+static void test_ctree_random(void)
+{
+    static char present[KEYS];
+    CTree tree;
+    int wrong = 0, invalid = 0;
+    size_t count, live = 0;
+
+    CHECK(ctree_init(&tree, 4) == SUCCESS);
+    CHECK(ctree_delete(&tree, 1) == FAILURE);
+    srand(11);
+    for (int i = 0; i < OPS; i++)
+    {
+        int key = rand() % KEYS;
+
+        if (rand() % 2)
+        {
+            wrong += ctree_insert(&tree, key) != (present[key] ? DUPLICATE : SUCCESS);
+            live += !present[key];
+            present[key] = 1;
+        }
+        else
+        {
+            wrong += ctree_delete(&tree, key) != (present[key] ? SUCCESS
+                                                  : tree.root ? DATA_NOT_FOUND : FAILURE);
+            live -= present[key];
+            present[key] = 0;
+        }
+        if (i % 1000 == 0)
+        {
+            count = 0;
+            invalid += (tree.root != CNIL && CNODE_COLOR(&tree, tree.root) != BLACK) ||
+                       check_cnode(&tree, tree.root, CNIL, (long)INT_MIN - 1,
+                                   (long)INT_MAX + 1, &count) < 0 ||
+                       count != live;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(invalid == 0);
+    for (int key = 0; key < KEYS; key++)
+        wrong += (ctree_search(&tree, key) == SUCCESS) != present[key];
+    CHECK(wrong == 0);
+
+    // Delete and reinsert one key: its slot comes back from the free list
+    uint32_t used = tree.used;
+    int key = 0;
+    while (!present[key])
+        key++;
+    ctree_delete(&tree, key);
+    ctree_insert(&tree, key);
+    CHECK(tree.used == used);
+
+    CHECK(ctree_destroy(&tree) == SUCCESS);
+}
+
+int main(void)
+{
+    test_layouts();
+    test_ctree_random();
+    return test_done("test_ctree");
+}
@@ -0,0 +1,196 @@
+/***********************************************************************
+ *  File Name   : test_cursor.c
+ *  Description : Regression tests for the in-order cursor (cursor.c):
+ *                seek_node(), next_node(), prev_node(), next_batch()
+ *                and visit_tree() against a reference table, on a tree
+ *                reshaped by inserts and deletes (which must keep the
+ *                RB_THREADED links right) and, with RB_LAZY_DELETE,
+ *                one holding tombstones the cursor must skip.
+ *
+ *  Functions:
+ *      - scan_errors()
+ *      - stop_at()
+ *      - test_scans()
+ *      - test_visit()
+ *      - test_tombstones()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+
+#define KEYS 3000
+
+/* --------------------------------------------------------------------
+ * Helper Function: scan_errors()
+ * Description: Compares every way of walking @root with the keys k in
+ *              [0, KEYS) with present[k]; returns the mismatches.
+ * --------------------------------------------------------------------*/
+static int scan_errors(Tree *root, const char *present)
+{
+    static const size_t batch[] = { 1, 7, 256 };
+    int keys[256], wrong = 0, expect;
+    Tree *node;
+
+    // seek_node() lands on the smallest key >= the probe
+    expect = -1;
+    for (int probe = KEYS; probe >= -1; probe--)
+    {
+        if (probe >= 0 && probe < KEYS && present[probe])
+            expect = probe;
+        node = seek_node(root, probe);
+        wrong += expect < 0 ? node != NULL : (node == NULL || node->data != expect);
+    }
+
+    // Forward and backward, one step at a time
+    expect = 0;
+    for (node = seek_node(root, INT_MIN); node; node = next_node(node), expect++)
+    {
+        while (expect < KEYS && !present[expect])
+            expect++;
+        wrong += node->data != expect;
+    }
+    while (expect < KEYS && !present[expect])
+        expect++;
+    wrong += expect != KEYS;
+
+    expect = KEYS - 1;
+    while (expect >= 0 && !present[expect])
+        expect--;
+    for (node = expect >= 0 ? seek_node(root, expect) : NULL; node; node = prev_node(node), expect--)
+    {
+        while (expect >= 0 && !present[expect])
+            expect--;
+        wrong += node->data != expect;
+    }
+    while (expect >= 0 && !present[expect])
+        expect--;
+    wrong += expect != -1;
+
+    // In batches, from the middle
+    for (int b = 0; b < 3; b++)
+    {
+        node = seek_node(root, KEYS / 2);
+        expect = KEYS / 2;
+        for (size_t n; (n = next_batch(&node, keys, batch[b])) > 0;)
+            for (size_t i = 0; i < n; i++, expect++)
+            {
+                while (expect < KEYS && !present[expect])
+                    expect++;
+                wrong += keys[i] != expect;
+            }
+    }
+    return wrong;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: stop_at()
+ * Description: Visitor counting nodes in *arg and returning DUPLICATE
+ *              (as a stand-in for any error) at key 100.
+ * --------------------------------------------------------------------*/
+static int stop_at(Tree *node, void *arg)
+{
+    (*(int *)arg)++;
+    return node->data == 100 ? DUPLICATE : SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_scans()
+ * Description: Scans of an empty tree, a random tree, and the same
+ *              tree after a round of deletes and reinserts.
+ * --------------------------------------------------------------------*/
+static void test_scans(void)
+{
+    static char present[KEYS];
+    Tree *root = NULL;
+    int keys[4];
+    Tree *cursor = NULL;
+
+    CHECK(seek_node(NULL, 0) == NULL && next_batch(&cursor, keys, 4) == 0);
+    CHECK(scan_errors(root, present) == 0);
+
+    srand(18);
+    for (int i = 0; i < KEYS; i++)
+    {
+        int key = rand() % KEYS;
+        present[key] = insert_node(&root, key) == SUCCESS || present[key];
+    }
+    CHECK(scan_errors(root, present) == 0);
+
+    for (int i = 0; i < KEYS; i++)
+    {
+        int key = rand() % KEYS;
+        if (rand() % 3)
+        {
+            delete_node(&root, key);
+            present[key] = 0;
+        }
+        else
+        {
+            insert_node(&root, key);
+            present[key] = 1;
+        }
+    }
+    CHECK(check_tree(root, NULL) == SUCCESS);
+    CHECK(scan_errors(root, present) == 0);
+    delete_tree(&root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_visit()
+ * Description: visit_tree() walks every node in order and passes a
+ *              visitor's error back, stopping there.
+ * --------------------------------------------------------------------*/
+static void test_visit(void)
+{
+    Tree *root = NULL;
+    int visited = 0;
+
+    CHECK(visit_tree(root, stop_at, &visited) == SUCCESS && visited == 0);
+    for (int i = 0; i < 1000; i++)
+        insert_node(&root, (int)((i * 7919L) % 1000));
+    CHECK(visit_tree(root, stop_at, &visited) == DUPLICATE && visited == 101);
+    delete_node(&root, 100);
+    visited = 0;
+    CHECK(visit_tree(root, stop_at, &visited) == SUCCESS && visited == 999);
+    delete_tree(&root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_tombstones()
+ * Description: With RB_LAZY_DELETE every walk skips tombstones,
+ *              including runs of them at either end.
+ * --------------------------------------------------------------------*/
+static void test_tombstones(void)
+{
+#ifdef RB_LAZY_DELETE
+    static char present[KEYS];
+    RBTree tree;
+
+    rbtree_init(&tree, NULL);
+    tree.max_dead_pct = 100;
+    for (int i = 0; i < KEYS; i++)
+    {
+        rbtree_insert(&tree, (int)((i * 7919L) % KEYS), NULL);
+        present[i] = 1;
+    }
+    for (int key = 0; key < KEYS; key++)
+        if (key < 50 || key >= KEYS - 50 || key % 4 == 1)
+        {
+            rbtree_lazy_delete(&tree, key);
+            present[key] = 0;
+        }
+    CHECK(scan_errors(tree.root, present) == 0);
+    rbtree_destroy(&tree);
+#endif
+}
+
+int main(void)
+{
+    test_scans();
+    test_visit();
+    test_tombstones();
+    return test_done("test_cursor");
+}
@@ -0,0 +1,105 @@
+/***********************************************************************
+ *  File Name   : test_frozen.c
+ *  Description : Regression tests for frozen Eytzinger snapshots
+ *                (frozen.c): frozen_search() must agree with
+ *                search_node() on the tree it was taken from.
+ *
+ *  Functions:
+ *      - agrees()
+ *      - test_sizes()
+ *      - test_extremes()
+ *      - test_tombstones()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../frozen.h"
+
+/* --------------------------------------------------------------------
+ * Helper Function: agrees()
+ * Description: Freezes @root and returns how many probes in [lo, hi]
+ *              the snapshot answers differently from the tree.
+ * --------------------------------------------------------------------*/
+static int agrees(Tree *root, int lo, int hi)
+{
+    FrozenTree *frozen = freeze(root);
+    int wrong = 0;
+
+    if (frozen == NULL)
+        return 1;
+    for (long key = lo; key <= hi; key++)
+        wrong += frozen_search(frozen, (int)key) != search_node(root, (int)key);
+    frozen_free(frozen);
+    return wrong;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_sizes()
+ * Description: Every size through a few complete levels, on odd keys
+ *              so each hit has misses on both sides.
+ * --------------------------------------------------------------------*/
+static void test_sizes(void)
+{
+    Tree *root = NULL;
+    int wrong = 0;
+
+    wrong += agrees(NULL, -2, 2);
+    for (int n = 1; n <= 130; n++)
+    {
+        insert_node(&root, (int)((n * 7919L) % 131) * 2 + 1);
+        wrong += agrees(root, -1, 265);
+    }
+    CHECK(wrong == 0);
+    delete_tree(&root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_extremes()
+ * Description: INT_MIN and INT_MAX as keys and as probes.
+ * --------------------------------------------------------------------*/
+static void test_extremes(void)
+{
+    Tree *root = NULL;
+
+    insert_node(&root, 0);
+    CHECK(agrees(root, INT_MIN, INT_MIN + 2) == 0 && agrees(root, INT_MAX - 2, INT_MAX) == 0);
+    insert_node(&root, INT_MIN);
+    insert_node(&root, INT_MAX);
+    CHECK(agrees(root, INT_MIN, INT_MIN + 2) == 0 && agrees(root, INT_MAX - 2, INT_MAX) == 0);
+    delete_tree(&root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_tombstones()
+ * Description: With RB_LAZY_DELETE a snapshot leaves tombstones out.
+ * --------------------------------------------------------------------*/
+static void test_tombstones(void)
+{
+#ifdef RB_LAZY_DELETE
+    RBTree tree;
+
+    rbtree_init(&tree, NULL);
+    tree.max_dead_pct = 100;
+    for (int i = 0; i < 500; i++)
+        rbtree_insert(&tree, i, NULL);
+    for (int i = 0; i < 500; i += 3)
+        rbtree_lazy_delete(&tree, i);
+
+    FrozenTree *frozen = freeze(tree.root);
+    CHECK(frozen && frozen->count == tree.count);
+    CHECK(agrees(tree.root, -1, 500) == 0);
+    frozen_free(frozen);
+    rbtree_destroy(&tree);
+#endif
+}
+
+int main(void)
+{
+    test_sizes();
+    test_extremes();
+    test_tombstones();
+    return test_done("test_frozen");
+}
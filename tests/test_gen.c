@@ -0,0 +1,126 @@
+/***********************************************************************
+ *  File Name   : test_gen.c
+ *  Description : Regression tests for the macro-generated tree
+ *                (tree_gen.h), instantiated here for int keys with
+ *                double values and for string keys.
+ *
+ *  Functions:
+ *      - check_gen()
+ *      - test_int_map()
+ *      - test_str_map()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../tree_gen.h"
+
+#define STR_CMP(a, b) strcmp((a), (b))
+
+RBTREE_PROTOTYPE_STATIC(imap, int, double)
+RBTREE_GENERATE_STATIC(imap, int, double, RBTREE_INT_CMP)
+RBTREE_PROTOTYPE_STATIC(smap, const char *, int)
+RBTREE_GENERATE_STATIC(smap, const char *, int, STR_CMP)
+
+#define KEYS 2000
+#define OPS 40000
+
+/* --------------------------------------------------------------------
+ * Helper Function: check_gen()
+ * Description: Validates an imap subtree like check_tree() does a
+ *              Tree. Returns its black height, or -1.
+ * --------------------------------------------------------------------*/
+static int check_gen(imap_node *node, imap_node *parent, long lo, long hi)
+{
+    if (node == NULL)
+        return 1;
+    if (node->parent != parent || node->key <= lo || node->key >= hi)
+        return -1;
+    if (node->color == RED &&
+        ((node->left && node->left->color == RED) ||
+         (node->right && node->right->color == RED)))
+        return -1;
+
+    int hl = check_gen(node->left, node, lo, node->key);
+    int hr = check_gen(node->right, node, node->key, hi);
+    return (hl < 0 || hl != hr) ? -1 : hl + (node->color == BLACK);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_int_map()
+ * Description: Random inserts and deletes against a reference table.
+ *              Nodes found by imap_search() must keep their key and
+ *              value while other keys come and go.
+ * --------------------------------------------------------------------*/
+static void test_int_map(void)
+{
+    static imap_node *handle[KEYS];
+    static char present[KEYS];
+    imap_node *root = NULL;
+    int wrong = 0, invalid = 0, moved = 0;
+
+    CHECK(imap_delete(&root, 1) == FAILURE);
+    srand(5);
+    for (int i = 0; i < OPS; i++)
+    {
+        int key = rand() % KEYS;
+
+        if (rand() % 2)
+        {
+            int flag = imap_insert(&root, key, key * 0.5);
+            wrong += flag != (present[key] ? DUPLICATE : SUCCESS);
+            present[key] = 1;
+            handle[key] = imap_search(root, key);
+        }
+        else
+        {
+            int flag = imap_delete(&root, key);
+            wrong += flag != (present[key] ? SUCCESS : DATA_NOT_FOUND);
+            present[key] = 0;
+        }
+        if (i % 1000 == 0)
+        {
+            invalid += (root && root->color != BLACK) ||
+                       check_gen(root, NULL, (long)INT_MIN - 1, (long)INT_MAX + 1) < 0;
+            for (int k = 0; k < KEYS; k++)
+                if (present[k])
+                    moved += imap_search(root, k) != handle[k] ||
+                             handle[k]->key != k || handle[k]->value != k * 0.5;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(invalid == 0);
+    CHECK(moved == 0);
+
+    CHECK(imap_destroy(&root) == SUCCESS && root == NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_str_map()
+ * Description: The comparator is expanded in place, so string keys
+ *              order by content, not by pointer.
+ * --------------------------------------------------------------------*/
+static void test_str_map(void)
+{
+    static const char *words[] = { "pear", "apple", "fig", "kiwi", "date", "lime" };
+    smap_node *root = NULL;
+    char probe[8];
+
+    for (int i = 0; i < 6; i++)
+        smap_insert(&root, words[i], i);
+    strcpy(probe, "kiwi");
+    CHECK(smap_search(root, probe) && smap_search(root, probe)->value == 3);
+    CHECK(smap_insert(&root, probe, 9) == DUPLICATE);
+    CHECK(smap_delete(&root, "fig") == SUCCESS);
+    CHECK(smap_search(root, "fig") == NULL && smap_search(root, "date") != NULL);
+    smap_destroy(&root);
+}
+
+int main(void)
+{
+    test_int_map();
+    test_str_map();
+    return test_done("test_gen");
+}
@@ -0,0 +1,273 @@
+/***********************************************************************
+ *  File Name   : test_handle.c
+ *  Description : Regression tests for node handles (tree.c): handles
+ *                from insert_handle() stay valid across other inserts
+ *                and erases, erase_handle() removes exactly its node,
+ *                and hinted inserts land in the right place whether or
+ *                not the hint is next to the key. Also the RBTree
+ *                handle (handle.c) used as a priority queue: its cached
+ *                min/max must track every insert, erase and pop.
+ *
+ *  Functions:
+ *      - test_stable_handles()
+ *      - test_hints()
+ *      - test_attach_leaf()
+ *      - ref_extremes()
+ *      - test_priority_queue()
+ *      - test_queue_costs()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+
+#define KEYS 3000
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_stable_handles()
+ * Description: Erases handles in scrambled order, checking after every
+ *              erase-heavy stretch that the surviving handles still
+ *              hold their keys and the tree is valid.
+ * --------------------------------------------------------------------*/
+static void test_stable_handles(void)
+{
+    static Tree *handle[KEYS];
+    Tree *root = NULL, *dup;
+    int wrong = 0, invalid = 0;
+    size_t count;
+
+    CHECK(erase_handle(&root, NULL) == FAILURE);
+    for (int i = 0; i < KEYS; i++)
+    {
+        int key = (int)((i * 7919L) % KEYS);
+        wrong += insert_handle(&root, key, &handle[key]) != SUCCESS || handle[key]->data != key;
+    }
+    CHECK(wrong == 0);
+    CHECK(insert_handle(&root, 17, &dup) == DUPLICATE && dup == handle[17]);
+    CHECK(erase_handle(&root, NULL) == FAILURE);
+
+    for (int i = 0; i < KEYS; i++)
+    {
+        int key = (int)((i * 4099L) % KEYS);
+        if (key % 3 == 0)
+            continue;
+        wrong += erase_handle(&root, handle[key]) != SUCCESS;
+        handle[key] = NULL;
+        if (i % 100 == 0)
+        {
+            for (int k = 0; k < KEYS; k++)
+                wrong += handle[k] && handle[k]->data != k;
+            invalid += check_tree(root, &count) != SUCCESS;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(invalid == 0);
+    CHECK(check_tree(root, &count) == SUCCESS && count == (KEYS + 2) / 3);
+    for (int k = 0; k < KEYS; k++)
+        wrong += (search_node(root, k) == SUCCESS) != (k % 3 == 0);
+    CHECK(wrong == 0);
+    delete_tree(&root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_hints()
+ * Description: Ascending and descending runs hinted at the previous
+ *              key (one comparison each with RB_STATS, bar the full
+ *              descent where the run turns), random hints,
+ *              and the pool variant.
+ * --------------------------------------------------------------------*/
+static void test_hints(void)
+{
+    Tree *root = NULL, *hint = NULL, *handle;
+    NodePool pool;
+    int wrong = 0;
+    size_t count;
+
+    reset_stats();
+    for (int i = 0; i < KEYS; i++)
+    {
+        wrong += insert_hint(&root, hint, i, &handle) != SUCCESS || handle->data != i;
+        hint = handle;
+    }
+    for (int i = -1; i >= -KEYS; i--)
+    {
+        wrong += insert_hint(&root, hint, i, &handle) != SUCCESS;
+        hint = handle;
+    }
+    CHECK(wrong == 0);
+    CHECK(check_tree(root, &count) == SUCCESS && count == 2 * KEYS);
+#ifdef RB_STATS
+    RBStats stats;
+    get_stats(&stats);
+    CHECK(stats.comparisons <= 2 * KEYS + RB_MAX_HEIGHT);   // one descent at the turn
+#endif
+    CHECK(insert_hint(&root, hint, 5, &handle) == DUPLICATE && handle->data == 5);
+    delete_tree(&root);
+
+    // Hints that are usually nowhere near the key
+    srand(17);
+    hint = NULL;
+    pool_init(&pool, 0);
+    for (int i = 0; i < KEYS; i++)
+    {
+        int key = rand() % (2 * KEYS), status = insert_hint_pool(&root, hint, key, &handle, &pool);
+        wrong += (status != SUCCESS && status != DUPLICATE) || handle->data != key;
+        if (i % 7 == 0)
+            hint = handle;
+    }
+    CHECK(wrong == 0);
+    CHECK(check_tree(root, NULL) == SUCCESS);
+    pool_destroy(&pool, &root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_attach_leaf()
+ * Description: Appending past the maximum as its right child, and
+ *              into an empty tree.
+ * --------------------------------------------------------------------*/
+static void test_attach_leaf(void)
+{
+    Tree *root = NULL, *max = NULL;
+    int wrong = 0;
+
+    for (int i = 0; i < KEYS; i++)
+        wrong += attach_leaf(&root, max, 1, i, &max, NULL) != SUCCESS;
+    CHECK(wrong == 0);
+    CHECK(check_tree(root, NULL) == SUCCESS && max->data == KEYS - 1 && max->right == NULL);
+    CHECK(search_node(root, KEYS / 2) == SUCCESS);
+    delete_tree(&root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: ref_extremes()
+ * Description: Smallest and largest k in [0, KEYS) with present[k], or
+ *              -1 and -1 if there is none.
+ * --------------------------------------------------------------------*/
+static void ref_extremes(const char *present, int *min, int *max)
+{
+    *min = 0;
+    while (*min < KEYS && !present[*min])
+        (*min)++;
+    *max = KEYS - 1;
+    while (*max >= 0 && !present[*max])
+        (*max)--;
+    if (*min == KEYS)
+        *min = -1;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_priority_queue()
+ * Description: Random inserts, deletes, erases by handle and pops at
+ *              both ends of a pooled RBTree, with peek_min/peek_max and
+ *              the count checked against a reference after every op.
+ * --------------------------------------------------------------------*/
+static void test_priority_queue(void)
+{
+    static char present[KEYS];
+    static Tree *handle[KEYS];
+    RBTree tree;
+    NodePool pool;
+    int wrong = 0, min, max, got, live = 0;
+
+    pool_init(&pool, 0);
+    rbtree_init(&tree, &pool);
+    CHECK(rbtree_peek_min(&tree, &got) == LIST_EMPTY && rbtree_peek_max(&tree, &got) == LIST_EMPTY);
+    CHECK(rbtree_pop_min(&tree, &got) == LIST_EMPTY && rbtree_pop_max(&tree, NULL) == LIST_EMPTY);
+
+    srand(22);
+    ref_extremes(present, &min, &max);
+    for (int i = 0; i < 10 * KEYS; i++)
+    {
+        int key = rand() % KEYS, op = rand() % 5;
+
+        if (op <= 1)
+        {
+            wrong += rbtree_insert(&tree, key, &handle[key]) != (present[key] ? DUPLICATE : SUCCESS);
+            live += !present[key];
+            present[key] = 1;
+        }
+        else if (op == 2 && live)
+        {
+            wrong += rbtree_pop_min(&tree, &got) != SUCCESS || got != min;
+            present[min] = 0;
+            live--;
+        }
+        else if (op == 3 && live)
+        {
+            wrong += rbtree_pop_max(&tree, &got) != SUCCESS || got != max;
+            present[max] = 0;
+            live--;
+        }
+        else if (present[key])
+        {
+            // Erase by handle or by key, alternately
+            wrong += (i % 2 ? rbtree_erase(&tree, handle[key]) : rbtree_delete(&tree, key)) != SUCCESS;
+            present[key] = 0;
+            live--;
+        }
+        else
+            wrong += rbtree_delete(&tree, key) != (live ? DATA_NOT_FOUND : FAILURE);
+
+        ref_extremes(present, &min, &max);
+        wrong += tree.count != (size_t)live;
+        if (live)
+            wrong += rbtree_peek_min(&tree, &got) != SUCCESS || got != min ||
+                     rbtree_peek_max(&tree, &got) != SUCCESS || got != max;
+        else
+            wrong += tree.min != NULL || tree.max != NULL;
+    }
+    CHECK(wrong == 0);
+    CHECK(check_tree(tree.root, NULL) == SUCCESS);
+    rbtree_destroy(&tree);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_queue_costs()
+ * Description: A timer-queue pattern, deadlines enqueued in order and
+ *              dequeued from the front, compares no keys at all (with
+ *              RB_STATS); with RB_LAZY_DELETE a cancelled head is
+ *              skipped by peek and pop.
+ * --------------------------------------------------------------------*/
+static void test_queue_costs(void)
+{
+    RBTree tree;
+    int got, wrong = 0;
+
+    rbtree_init(&tree, NULL);
+    reset_stats();
+    for (int i = 0; i < KEYS; i++)
+    {
+        rbtree_insert(&tree, i, NULL);
+        if (i % 2)
+            wrong += rbtree_pop_min(&tree, &got) != SUCCESS || got != i / 2;
+    }
+    CHECK(wrong == 0 && tree.count == KEYS / 2);
+#ifdef RB_STATS
+    RBStats stats;
+    get_stats(&stats);
+    CHECK(stats.comparisons == 0);
+#endif
+
+#ifdef RB_LAZY_DELETE
+    tree.max_dead_pct = 100;
+    rbtree_lazy_delete(&tree, KEYS / 2);
+    rbtree_lazy_delete(&tree, KEYS / 2 + 1);
+    rbtree_lazy_delete(&tree, KEYS - 1);
+    CHECK(rbtree_peek_min(&tree, &got) == SUCCESS && got == KEYS / 2 + 2);
+    CHECK(rbtree_peek_max(&tree, &got) == SUCCESS && got == KEYS - 2);
+    CHECK(rbtree_pop_min(&tree, &got) == SUCCESS && got == KEYS / 2 + 2);
+#endif
+    rbtree_destroy(&tree);
+}
+
+int main(void)
+{
+    test_stable_handles();
+    test_hints();
+    test_attach_leaf();
+    test_priority_queue();
+    test_queue_costs();
+    return test_done("test_handle");
+}
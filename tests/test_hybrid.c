@@ -0,0 +1,165 @@
+/***********************************************************************
+ *  File Name   : test_hybrid.c
+ *  Description : Regression tests for the fat-leaf hybrid tree
+ *                (hybrid.c): the bucket index stays a valid tree, each
+ *                bucket sorted, padded, within its separators and at
+ *                least HYBRID_MIN full, through random churn, runs that
+ *                split and merge bucket after bucket, and extreme keys.
+ *
+ *  Functions:
+ *      - check_buckets()
+ *      - test_random_ops()
+ *      - test_runs()
+ *      - test_extremes()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../hybrid.h"
+
+#define KEYS 20000
+#define OPS 200000
+
+/* --------------------------------------------------------------------
+ * Helper Function: check_buckets()
+ * Description: Returns SUCCESS if the index and every bucket are
+ *              consistent with each other and with the counts in @tree.
+ * --------------------------------------------------------------------*/
+static int check_buckets(const HybridTree *tree)
+{
+    size_t nodes, keys = 0, buckets = 0;
+    long prev = (long)INT_MIN - 1;
+
+    if (check_tree(tree->root, &nodes) != SUCCESS || nodes != tree->buckets)
+        return FAILURE;
+    for (Tree *node = seek_node(tree->root, INT_MIN); node; node = next_node(node))
+    {
+        const Bucket *b = NODE_BUCKET(node);
+        Tree *next = next_node(node);
+
+        if (b->count < 1 || b->count > HYBRID_K || (b->count < HYBRID_MIN && tree->buckets > 1))
+            return FAILURE;
+        if (b->keys[0] < node->data || (next && b->keys[b->count - 1] >= next->data))
+            return FAILURE;
+        for (int i = 0; i < HYBRID_K; i++)
+        {
+            if (i < b->count ? b->keys[i] <= prev : b->keys[i] != INT_MAX)
+                return FAILURE;
+            if (i < b->count)
+                prev = b->keys[i];
+        }
+        keys += (size_t)b->count;
+        buckets++;
+    }
+    return keys == tree->count && buckets == tree->buckets ? SUCCESS : FAILURE;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_random_ops()
+ * Description: Random inserts and deletes against a reference table.
+ * --------------------------------------------------------------------*/
+static void test_random_ops(void)
+{
+    static char present[KEYS];
+    HybridTree tree;
+    int wrong = 0, invalid = 0;
+
+    CHECK(hybrid_init(&tree) == SUCCESS && hybrid_delete(&tree, 1) == FAILURE);
+    srand(21);
+    for (int i = 0; i < OPS; i++)
+    {
+        int key = rand() % KEYS;
+
+        if (rand() % 2)
+        {
+            wrong += hybrid_insert(&tree, key) != (present[key] ? DUPLICATE : SUCCESS);
+            present[key] = 1;
+        }
+        else
+        {
+            wrong += hybrid_delete(&tree, key) != (present[key] ? SUCCESS
+                                                   : tree.root ? DATA_NOT_FOUND : FAILURE);
+            present[key] = 0;
+        }
+        if (i % 5000 == 0)
+            invalid += check_buckets(&tree) != SUCCESS;
+    }
+    CHECK(wrong == 0);
+    CHECK(invalid == 0);
+    for (int key = -1; key <= KEYS; key++)
+        wrong += (hybrid_search(&tree, key) == SUCCESS) != (key >= 0 && key < KEYS && present[key]);
+    CHECK(wrong == 0);
+    CHECK(hybrid_destroy(&tree) == SUCCESS && tree.root == NULL && tree.count == 0);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_runs()
+ * Description: Ascending and descending inserts split bucket after
+ *              bucket; deleting from the front, the back and every
+ *              other key merges and evens them out, down to empty.
+ * --------------------------------------------------------------------*/
+static void test_runs(void)
+{
+    HybridTree tree;
+    int invalid = 0;
+
+    hybrid_init(&tree);
+    for (int i = 0; i < KEYS; i++)
+        hybrid_insert(&tree, i);
+    for (int i = -1; i >= -KEYS; i--)
+        hybrid_insert(&tree, i);
+    CHECK(check_buckets(&tree) == SUCCESS && tree.count == 2 * KEYS);
+    CHECK(tree.buckets <= 2 * KEYS / (HYBRID_K / 2) + 1);
+
+    for (int i = -KEYS; i < 0; i += 2)
+        hybrid_delete(&tree, i);
+    for (int i = -KEYS + 1; i < 0; i += 2)
+    {
+        hybrid_delete(&tree, i);
+        if (i % 997 == 0)
+            invalid += check_buckets(&tree) != SUCCESS;
+    }
+    for (int i = KEYS - 1; i >= 0; i--)
+    {
+        hybrid_delete(&tree, i);
+        if (i % 997 == 0)
+            invalid += check_buckets(&tree) != SUCCESS;
+    }
+    CHECK(invalid == 0);
+    CHECK(tree.root == NULL && tree.count == 0 && tree.buckets == 0);
+    hybrid_destroy(&tree);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_extremes()
+ * Description: INT_MAX, the padding value, and INT_MIN as keys; a key
+ *              below every separator moves the first one down.
+ * --------------------------------------------------------------------*/
+static void test_extremes(void)
+{
+    HybridTree tree;
+
+    hybrid_init(&tree);
+    CHECK(hybrid_insert(&tree, 0) == SUCCESS);
+    CHECK(hybrid_search(&tree, INT_MAX) == DATA_NOT_FOUND);
+    CHECK(hybrid_insert(&tree, INT_MAX) == SUCCESS && hybrid_insert(&tree, INT_MAX) == DUPLICATE);
+    CHECK(hybrid_insert(&tree, INT_MIN) == SUCCESS && tree.root->data == INT_MIN);
+    CHECK(hybrid_search(&tree, INT_MAX) == SUCCESS && hybrid_search(&tree, INT_MIN) == SUCCESS);
+    for (int i = 1; i <= 2 * HYBRID_K; i++)
+        hybrid_insert(&tree, INT_MAX - i);
+    CHECK(check_buckets(&tree) == SUCCESS && tree.buckets > 1);
+    CHECK(hybrid_delete(&tree, INT_MAX) == SUCCESS && hybrid_search(&tree, INT_MAX) == DATA_NOT_FOUND);
+    CHECK(check_buckets(&tree) == SUCCESS);
+    hybrid_destroy(&tree);
+}
+
+int main(void)
+{
+    test_random_ops();
+    test_runs();
+    test_extremes();
+    return test_done("test_hybrid");
+}
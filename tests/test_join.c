@@ -0,0 +1,245 @@
+/***********************************************************************
+ *  File Name   : test_join.c
+ *  Description : Regression tests for join, split and the join-based
+ *                set operations (join.c), small and random against
+ *                reference tables, and large enough that the set
+ *                operations recurse on worker threads; and the range
+ *                cuts built on them, extract_range() and delete_range().
+ *
+ *  Functions:
+ *      - build_set()
+ *      - matches()
+ *      - test_join_split()
+ *      - test_set_ops()
+ *      - test_parallel_set_ops()
+ *      - test_ranges()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+
+#define KEYS 2000
+#define BIG 600000
+
+/* --------------------------------------------------------------------
+ * Helper Function: build_set()
+ * Description: Builds a tree of the keys k in [0, @n) with set[k].
+ * --------------------------------------------------------------------*/
+static Tree *build_set(const char *set, int n)
+{
+    static int keys[BIG];
+    size_t count = 0;
+
+    for (int k = 0; k < n; k++)
+        if (set[k])
+            keys[count++] = k;
+    return build_from_sorted(keys, count);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: matches()
+ * Description: Returns 1 if @root is a valid tree holding exactly the
+ *              keys k in [0, @n) with set[k].
+ * --------------------------------------------------------------------*/
+static int matches(Tree *root, const char *set, int n)
+{
+    size_t count, live = 0;
+
+    if (check_tree(root, &count) != SUCCESS)
+        return 0;
+    for (int k = 0; k < n; k++)
+    {
+        if ((search_node(root, k) == SUCCESS) != set[k])
+            return 0;
+        live += set[k];
+    }
+    return count == live;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_join_split()
+ * Description: Splitting a random tree at every key, present or not,
+ *              and joining it back; joins of uneven heights and
+ *              misordered inputs.
+ * --------------------------------------------------------------------*/
+static void test_join_split(void)
+{
+    static char set[KEYS];
+    Tree *root, *left, *right;
+    int wrong = 0;
+
+    srand(15);
+    for (int k = 0; k < KEYS; k++)
+        set[k] = rand() % 2;
+    root = build_set(set, KEYS);
+
+    for (int k = -1; k <= KEYS; k += 7)
+    {
+        int present = k >= 0 && k < KEYS && set[k];
+        int status = split_tree(&root, k, &left, &right);
+
+        wrong += root != NULL || status != (present ? SUCCESS : DATA_NOT_FOUND);
+        wrong += check_tree(left, NULL) != SUCCESS || check_tree(right, NULL) != SUCCESS;
+        Tree *max = left;
+        while (max && max->right)
+            max = max->right;
+        wrong += (max && max->data >= k) || (right && findmin(right)->data <= k);
+        wrong += join_trees(&root, left, k, right) != SUCCESS;
+        if (!present && delete_node(&root, k) != SUCCESS)
+            wrong++;
+    }
+    CHECK(wrong == 0);
+    CHECK(matches(root, set, KEYS));
+
+    // Misordered inputs are refused and left as they were
+    split_tree(&root, KEYS / 2, &left, &right);
+    CHECK(join_trees(&root, right, KEYS / 2, left) == FAILURE);
+    CHECK(join_trees(&root, left, KEYS + 1, right) == FAILURE);
+    CHECK(join_trees(&root, left, KEYS / 2, right) == SUCCESS);
+    set[KEYS / 2] = 1;
+    CHECK(matches(root, set, KEYS));
+    delete_tree(&root);
+
+    // One side empty or a single node, the other much taller
+    int keys[KEYS];
+    for (int k = 0; k < KEYS; k++)
+        keys[k] = k;
+    left = build_from_sorted(keys, 1);
+    right = build_from_sorted(keys + 2, KEYS - 2);
+    CHECK(join_trees(&root, left, 1, right) == SUCCESS && check_tree(root, NULL) == SUCCESS);
+    delete_tree(&root);
+    right = build_from_sorted(keys, KEYS - 1);
+    CHECK(join_trees(&root, right, KEYS, NULL) == SUCCESS && check_tree(root, NULL) == SUCCESS);
+    delete_tree(&root);
+    CHECK(join_trees(&root, NULL, 0, NULL) == SUCCESS && root && root->data == 0);
+    delete_tree(&root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_set_ops()
+ * Description: Union, intersection and difference of random sets of
+ *              differing densities, empty ones included.
+ * --------------------------------------------------------------------*/
+static void test_set_ops(void)
+{
+    static char a[KEYS], b[KEYS], expect[KEYS];
+    static const int density[] = { 0, 1, 10, 50, 100 };
+    int wrong = 0;
+
+    srand(16);
+    for (int da = 0; da < 5; da++)
+        for (int db = 0; db < 5; db++)
+            for (int op = 0; op < 3; op++)
+            {
+                for (int k = 0; k < KEYS; k++)
+                {
+                    a[k] = rand() % 100 < density[da];
+                    b[k] = rand() % 100 < density[db];
+                    expect[k] = op == 0 ? (a[k] | b[k]) : op == 1 ? (a[k] & b[k]) : (a[k] & !b[k]);
+                }
+                Tree *ta = build_set(a, KEYS), *tb = build_set(b, KEYS);
+                Tree *result = op == 0 ? union_trees(ta, tb)
+                             : op == 1 ? intersect_trees(ta, tb) : subtract_trees(ta, tb);
+                wrong += !matches(result, expect, KEYS);
+                delete_tree(&result);
+            }
+    CHECK(wrong == 0);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_parallel_set_ops()
+ * Description: Multiples of 2 against multiples of 3 below BIG, deep
+ *              enough for the recursion to spawn threads.
+ * --------------------------------------------------------------------*/
+static void test_parallel_set_ops(void)
+{
+    static char twos[BIG], threes[BIG], expect[BIG];
+
+    for (int k = 0; k < BIG; k++)
+    {
+        twos[k] = k % 2 == 0;
+        threes[k] = k % 3 == 0;
+    }
+    for (int op = 0; op < 3; op++)
+    {
+        for (int k = 0; k < BIG; k++)
+            expect[k] = op == 0 ? (twos[k] | threes[k]) : op == 1 ? (twos[k] & threes[k])
+                                                                  : (twos[k] & !threes[k]);
+        Tree *ta = build_set(twos, BIG), *tb = build_set(threes, BIG);
+        Tree *result = op == 0 ? union_trees(ta, tb)
+                     : op == 1 ? intersect_trees(ta, tb) : subtract_trees(ta, tb);
+        CHECK(matches(result, expect, BIG));
+        delete_tree(&result);
+    }
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_ranges()
+ * Description: Random ranges, bounds present or not, cut out and put
+ *              back with union_trees(); empty, inverted and whole-tree
+ *              ranges; delete_range() on malloc'd and pooled nodes.
+ * --------------------------------------------------------------------*/
+static void test_ranges(void)
+{
+    static char set[KEYS], inside[KEYS], outside[KEYS];
+    Tree *root, *range;
+    NodePool pool;
+    int wrong = 0;
+
+    srand(19);
+    for (int k = 0; k < KEYS; k++)
+        set[k] = rand() % 3 != 0;
+    root = build_set(set, KEYS);
+
+    for (int i = 0; i < 200; i++)
+    {
+        int lo = rand() % (KEYS + 20) - 10, hi = lo + rand() % (i % 2 ? 40 : KEYS);
+        int any = 0;
+
+        for (int k = 0; k < KEYS; k++)
+        {
+            inside[k] = set[k] && k >= lo && k <= hi;
+            outside[k] = set[k] && !inside[k];
+            any |= inside[k];
+        }
+        wrong += extract_range(&root, lo, hi, &range) != (any ? SUCCESS : DATA_NOT_FOUND);
+        wrong += !matches(root, outside, KEYS) || !matches(range, inside, KEYS);
+        root = union_trees(root, range);
+    }
+    CHECK(wrong == 0);
+    CHECK(matches(root, set, KEYS));
+
+    CHECK(extract_range(&root, 10, 9, &range) == FAILURE && range == NULL);
+    CHECK(extract_range(&root, KEYS, INT_MAX, &range) == DATA_NOT_FOUND && range == NULL);
+    CHECK(extract_range(&root, INT_MIN, INT_MAX, &range) == SUCCESS && root == NULL);
+    CHECK(matches(range, set, KEYS));
+    root = range;
+
+    // Free the middle third in one go
+    CHECK(delete_range(&root, KEYS / 3, 2 * KEYS / 3) == SUCCESS);
+    for (int k = KEYS / 3; k <= 2 * KEYS / 3; k++)
+        set[k] = 0;
+    CHECK(matches(root, set, KEYS));
+    delete_tree(&root);
+
+    pool_init(&pool, 0);
+    for (int k = 0; k < KEYS; k++)
+        insert_node_pool(&root, k, &pool);
+    CHECK(delete_range_pool(&root, 1, KEYS - 2, &pool) == SUCCESS);
+    CHECK(check_tree(root, NULL) == SUCCESS && search_node(root, 0) == SUCCESS &&
+          search_node(root, KEYS - 1) == SUCCESS && search_node(root, 1) == DATA_NOT_FOUND);
+    CHECK(delete_range_pool(&root, 1, KEYS - 2, &pool) == DATA_NOT_FOUND);
+    pool_destroy(&pool, &root);
+}
+
+int main(void)
+{
+    test_join_split();
+    test_set_ops();
+    test_parallel_set_ops();
+    test_ranges();
+    return test_done("test_join");
+}
@@ -0,0 +1,171 @@
+/***********************************************************************
+ *  File Name   : test_lazy.c
+ *  Description : Regression tests for tombstone deletes (lazy.c).
+ *                Covers the two ways a tombstone used to be lost: a
+ *                save/load round trip writing it as a live key, and a
+ *                top-down delete moving a key without its dead bit.
+ *                Needs FEATURES="-DRB_LAZY_DELETE"; skipped otherwise.
+ *
+ *  Functions:
+ *      - build_half_dead()
+ *      - test_lazy_basics()
+ *      - test_save_skips_tombstones()
+ *      - test_raw_deletes_keep_tombstones()
+ *      - test_purge()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../store.h"
+
+#ifdef RB_LAZY_DELETE
+#define N 2000
+
+/* --------------------------------------------------------------------
+ * Helper Function: build_half_dead()
+ * Description: Fills @tree with 0..N-1 in scrambled order, so keys of
+ *              both parities sit on inner nodes, and tombstones every
+ *              odd key, with purging disabled so the tombstones stay.
+ * --------------------------------------------------------------------*/
+static void build_half_dead(RBTree *tree)
+{
+    rbtree_init(tree, NULL);
+    tree->max_dead_pct = 100;
+    for (int i = 0; i < N; i++)
+        rbtree_insert(tree, (int)((i * 7919L) % N), NULL);
+    for (int i = 1; i < N; i += 2)
+        rbtree_lazy_delete(tree, i);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_lazy_basics()
+ * Description: Tombstones hide keys, keep the counts and extremes
+ *              right, and revive on insert.
+ * --------------------------------------------------------------------*/
+static void test_lazy_basics(void)
+{
+    RBTree tree;
+    int data;
+
+    build_half_dead(&tree);
+    CHECK(tree.count == N / 2 && tree.dead == N / 2);
+    CHECK(search_node(tree.root, 1) == DATA_NOT_FOUND);
+    CHECK(search_node(tree.root, 2) == SUCCESS);
+    CHECK(rbtree_lazy_delete(&tree, 1) == DATA_NOT_FOUND);
+    CHECK(rbtree_lazy_delete(&tree, N) == DATA_NOT_FOUND);
+
+    CHECK(rbtree_peek_max(&tree, &data) == SUCCESS && data == N - 2);
+    CHECK(rbtree_insert(&tree, N - 1, NULL) == SUCCESS);
+    CHECK(tree.count == N / 2 + 1 && tree.dead == N / 2 - 1);
+    CHECK(search_node(tree.root, N - 1) == SUCCESS);
+    CHECK(rbtree_peek_max(&tree, &data) == SUCCESS && data == N - 1);
+    CHECK(rbtree_insert(&tree, N - 1, NULL) == DUPLICATE);
+    CHECK(check_tree(tree.root, NULL) == SUCCESS);
+    rbtree_destroy(&tree);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_save_skips_tombstones()
+ * Description: A saved tree holding tombstones loads back as exactly
+ *              its live keys, in a valid tree.
+ * --------------------------------------------------------------------*/
+static void test_save_skips_tombstones(void)
+{
+    RBTree tree;
+    Tree *loaded = NULL;
+    char path[64];
+    size_t count;
+    int wrong = 0;
+
+    build_half_dead(&tree);
+    test_path(path, sizeof(path), "lazy");
+    CHECK(save_tree(tree.root, path) == SUCCESS);
+    CHECK(load_tree(path, &loaded) == SUCCESS);
+    unlink(path);
+
+    CHECK(check_tree(loaded, &count) == SUCCESS);
+    CHECK(count == N / 2);
+    for (int i = 0; i < N; i++)
+        wrong += (search_node(loaded, i) == SUCCESS) != (i % 2 == 0);
+    CHECK(wrong == 0);
+
+    delete_tree(&loaded);
+    rbtree_destroy(&tree);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_raw_deletes_keep_tombstones()
+ * Description: delete_node() and delete_node_topdown() on a tree with
+ *              tombstones neither revive a dead key nor hide a live
+ *              one. Each key the top-down delete removes has a dead
+ *              predecessor, so every time it deletes an inner node it
+ *              moves a tombstone's key.
+ * --------------------------------------------------------------------*/
+static void test_raw_deletes_keep_tombstones(void)
+{
+    RBTree tree;
+    int wrong = 0;
+
+    build_half_dead(&tree);
+    for (int i = 4; i < N; i += 4)
+        delete_node_topdown(&tree.root, i);
+    for (int i = 2; i < N; i += 4)
+        delete_node(&tree.root, i);
+    CHECK(check_tree(tree.root, NULL) == SUCCESS);
+
+    for (int i = 0; i < N; i++)
+        wrong += (search_node(tree.root, i) == SUCCESS) != (i == 0);
+    CHECK(wrong == 0);
+
+    // The raw deletes bypassed the handle, so only the root is trusted
+    delete_tree(&tree.root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_purge()
+ * Description: rbtree_purge() drops every tombstone and keeps handles
+ *              to live keys valid; crossing max_dead_pct purges on its
+ *              own.
+ * --------------------------------------------------------------------*/
+static void test_purge(void)
+{
+    RBTree tree;
+    Tree *handle;
+    size_t count;
+
+    build_half_dead(&tree);
+    rbtree_insert(&tree, 10, &handle);   // already live: just the handle
+    CHECK(rbtree_purge(&tree) == SUCCESS);
+    CHECK(tree.dead == 0 && tree.count == N / 2);
+    CHECK(check_tree(tree.root, &count) == SUCCESS && count == N / 2);
+    CHECK(handle->data == 10 && search_node(tree.root, 10) == SUCCESS);
+    rbtree_destroy(&tree);
+
+    rbtree_init(&tree, NULL);
+    for (int i = 0; i < 100; i++)
+        rbtree_insert(&tree, i, NULL);
+    for (int i = 0; i < 100; i += 2)
+        rbtree_lazy_delete(&tree, i);
+    CHECK(tree.dead * 100 <= (size_t)tree.max_dead_pct * (tree.count + tree.dead));
+    CHECK(tree.count == 50);
+    CHECK(check_tree(tree.root, NULL) == SUCCESS);
+    rbtree_destroy(&tree);
+}
+#endif
+
+int main(void)
+{
+#ifdef RB_LAZY_DELETE
+    test_lazy_basics();
+    test_save_skips_tombstones();
+    test_raw_deletes_keep_tombstones();
+    test_purge();
+    return test_done("test_lazy");
+#else
+    printf("test_lazy: skipped (needs -DRB_LAZY_DELETE)\n");
+    return EXIT_SUCCESS;
+#endif
+}
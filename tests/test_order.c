@@ -0,0 +1,113 @@
+/***********************************************************************
+ *  File Name   : test_order.c
+ *  Description : Regression tests for the order-statistic augmentation
+ *                (rank_node(), select_node(), count_range()), compared
+ *                with a sorted reference array after inserts, deletes
+ *                and the other size-maintaining mutators. Needs
+ *                FEATURES="-DRB_ORDER_STATS"; skipped otherwise.
+ *
+ *  Functions:
+ *      - check_queries()
+ *      - test_order_stats()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+
+#ifdef RB_ORDER_STATS
+#define N 3000
+
+/* --------------------------------------------------------------------
+ * Helper Function: check_queries()
+ * Description: Compares every query on @root with the answer from the
+ *              @n sorted keys in @keys. Returns the number of misses.
+ * --------------------------------------------------------------------*/
+static int check_queries(Tree *root, const int *keys, size_t n)
+{
+    int wrong = 0, data;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        wrong += rank_node(root, keys[i]) != i;
+        wrong += rank_node(root, keys[i] + 1) != i + 1;
+        wrong += select_node(root, i, &data) != SUCCESS || data != keys[i];
+    }
+    wrong += select_node(root, n, &data) != DATA_NOT_FOUND;
+    wrong += rank_node(root, INT_MAX) != n;
+
+    for (size_t i = 0; i + 40 < n; i += 37)
+    {
+        wrong += count_range(root, keys[i], keys[i + 40]) != 41;
+        wrong += count_range(root, keys[i] + 1, keys[i + 40] - 1) != 39;
+    }
+    wrong += count_range(root, INT_MIN, INT_MAX) != n;
+    wrong += count_range(root, 5, 4) != 0;
+    return wrong;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_order_stats()
+ * Description: Keys 0, 10, 20, ... inserted in scrambled order, then
+ *              every third one removed by delete_node(), erase_handle()
+ *              and delete_node_topdown() in turn, and the tree split
+ *              and joined back.
+ * --------------------------------------------------------------------*/
+static void test_order_stats(void)
+{
+    static int keys[N];
+    Tree *root = NULL, *left, *right, *handle;
+    size_t n = 0;
+
+    CHECK(rank_node(NULL, 1) == 0 && count_range(NULL, 0, 9) == 0);
+
+    for (int i = 0; i < N; i++)
+        insert_node(&root, (int)((i * 7919L) % N) * 10);
+    for (int i = 0; i < N; i++)
+        keys[i] = i * 10;
+    CHECK(check_tree(root, NULL) == SUCCESS);
+    CHECK(check_queries(root, keys, N) == 0);
+
+    for (int i = 0; i < N; i++)
+    {
+        if (i % 3)
+        {
+            keys[n++] = i * 10;
+            continue;
+        }
+        if (i % 9 == 0)
+            delete_node(&root, i * 10);
+        else if (i % 9 == 3)
+        {
+            insert_handle(&root, i * 10, &handle);     // DUPLICATE, but finds it
+            erase_handle(&root, handle);
+        }
+        else
+            delete_node_topdown(&root, i * 10);
+    }
+    CHECK(check_tree(root, NULL) == SUCCESS);
+    CHECK(check_queries(root, keys, n) == 0);
+
+    CHECK(split_tree(&root, keys[n / 2], &left, &right) == SUCCESS);
+    CHECK(check_tree(left, NULL) == SUCCESS && check_tree(right, NULL) == SUCCESS);
+    CHECK(check_queries(left, keys, n / 2) == 0);
+    CHECK(check_queries(right, keys + n / 2 + 1, n - n / 2 - 1) == 0);
+    CHECK(join_trees(&root, left, keys[n / 2], right) == SUCCESS);
+    CHECK(check_tree(root, NULL) == SUCCESS);
+    CHECK(check_queries(root, keys, n) == 0);
+    delete_tree(&root);
+}
+#endif
+
+int main(void)
+{
+#ifdef RB_ORDER_STATS
+    test_order_stats();
+    return test_done("test_order");
+#else
+    printf("test_order: skipped (needs -DRB_ORDER_STATS)\n");
+    return EXIT_SUCCESS;
+#endif
+}
@@ -0,0 +1,108 @@
+/***********************************************************************
+ *  File Name   : test_pool.c
+ *  Description : Regression tests for the slab node pool (pool.c) and
+ *                the pool-backed tree operations.
+ *
+ *  Functions:
+ *      - test_alloc_free()
+ *      - test_pool_tree()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+
+#define SLAB 64
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_alloc_free()
+ * Description: Nodes come from slabs of the requested size, freed
+ *              nodes are reused first, and a destroyed pool can be
+ *              used again.
+ * --------------------------------------------------------------------*/
+static void test_alloc_free(void)
+{
+    NodePool pool;
+    Tree *nodes[SLAB + 1];
+    int distinct = 1;
+
+    CHECK(pool_init(NULL, 0) == FAILURE);
+    CHECK(pool_init(&pool, 0) == SUCCESS && pool.slab_nodes == POOL_SLAB_NODES);
+    CHECK(pool_destroy(&pool, NULL) == SUCCESS);
+
+    CHECK(pool_init(&pool, SLAB) == SUCCESS);
+    for (int i = 0; i <= SLAB; i++)
+    {
+        nodes[i] = pool_alloc(&pool);
+        nodes[i]->data = i;
+    }
+    for (int i = 0; i <= SLAB; i++)
+        distinct &= (nodes[i]->data == i);
+    CHECK(distinct);
+    CHECK(nodes[1] == nodes[0] + 1);                 // carved from one slab
+    CHECK(pool.slabs && pool.slabs->next);           // SLAB + 1 needs two
+
+    pool_free(&pool, nodes[5]);
+    pool_free(&pool, nodes[9]);
+    CHECK(pool_alloc(&pool) == nodes[9]);
+    CHECK(pool_alloc(&pool) == nodes[5]);
+
+    Tree *root = nodes[0];
+    CHECK(pool_destroy(&pool, &root) == SUCCESS && root == NULL);
+    CHECK(pool.slabs == NULL && pool.free_list == NULL);
+    CHECK(pool_alloc(&pool) != NULL);                // usable again
+    pool_destroy(&pool, NULL);
+
+    Tree *node = pool_alloc(NULL);                   // malloc fallback
+    CHECK(node != NULL);
+    pool_free(NULL, node);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_pool_tree()
+ * Description: Pool-backed insert/delete keep a valid tree, deleted
+ *              nodes are recycled, and delete_tree_pool() returns every
+ *              node to the pool.
+ * --------------------------------------------------------------------*/
+static void test_pool_tree(void)
+{
+    NodePool pool;
+    Tree *root = NULL;
+    size_t count;
+    int failed = 0;
+
+    pool_init(&pool, SLAB);
+    for (int i = 0; i < 10 * SLAB; i++)
+        failed += insert_node_pool(&root, (int)((i * 7919L) % (10 * SLAB)), &pool) != SUCCESS;
+    CHECK(failed == 0);
+    CHECK(insert_node_pool(&root, 0, &pool) == DUPLICATE);
+    CHECK(check_tree(root, &count) == SUCCESS && count == 10 * SLAB);
+
+    for (int i = 0; i < 10 * SLAB; i += 2)
+        failed += delete_node_pool(&root, i, &pool) != SUCCESS;
+    CHECK(failed == 0);
+    CHECK(delete_node_pool(&root, 0, &pool) == DATA_NOT_FOUND);
+    CHECK(check_tree(root, &count) == SUCCESS && count == 5 * SLAB);
+
+    // Refilling the holes must not need a new slab
+    Slab *head = pool.slabs;
+    for (int i = 0; i < 10 * SLAB; i += 2)
+        insert_node_pool(&root, i, &pool);
+    CHECK(pool.slabs == head);
+
+    CHECK(delete_tree_pool(&root, &pool) == SUCCESS && root == NULL);
+    size_t freed = 0;
+    for (Tree *node = pool.free_list; node; node = node->right)
+        freed++;
+    CHECK(freed == 10 * SLAB);
+    pool_destroy(&pool, NULL);
+}
+
+int main(void)
+{
+    test_alloc_free();
+    test_pool_tree();
+    return test_done("test_pool");
+}
@@ -0,0 +1,198 @@
+/***********************************************************************
+ *  File Name   : test_ptree.c
+ *  Description : Regression tests for the persistent copy-on-write
+ *                tree (ptree.c): every kept version must stay exactly
+ *                as it was, and lock-free readers must always see a
+ *                complete, valid version while a writer publishes.
+ *
+ *  Functions:
+ *      - check_pnode()
+ *      - test_versions()
+ *      - reader_main()
+ *      - test_concurrent()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../ptree.h"
+
+#define KEYS 512
+#define VERSIONS 400
+#define READERS 3
+
+/* --------------------------------------------------------------------
+ * Helper Function: check_pnode()
+ * Description: Validates a version's subtree (order, coloring, black
+ *              height), counting its nodes in *count. Returns its black
+ *              height, or -1.
+ * --------------------------------------------------------------------*/
+static int check_pnode(const PNode *node, long lo, long hi, size_t *count)
+{
+    if (node == NULL)
+        return 1;
+    if (node->data <= lo || node->data >= hi)
+        return -1;
+    if (node->color == RED &&
+        ((node->link[0] && node->link[0]->color == RED) ||
+         (node->link[1] && node->link[1]->color == RED)))
+        return -1;
+
+    (*count)++;
+    int hl = check_pnode(node->link[0], lo, node->data, count);
+    int hr = check_pnode(node->link[1], node->data, hi, count);
+    return (hl < 0 || hl != hr) ? -1 : hl + (node->color == BLACK);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_versions()
+ * Description: Keeps every version of a random op sequence alive with
+ *              its expected key set, then checks all of them, releases
+ *              them in a scrambled order and checks the survivors.
+ * --------------------------------------------------------------------*/
+static void test_versions(void)
+{
+    static PNode *version[VERSIONS];
+    static char member[VERSIONS][KEYS];
+    int wrong = 0, invalid = 0, status;
+    size_t count;
+
+    version[0] = NULL;
+    srand(9);
+    for (int v = 1; v < VERSIONS; v++)
+    {
+        int key = rand() % KEYS, insert = rand() % 3 != 0;
+
+        memcpy(member[v], member[v - 1], KEYS);
+        if (insert)
+        {
+            version[v] = pt_insert(version[v - 1], key, &status);
+            wrong += status != (member[v][key] ? DUPLICATE : SUCCESS);
+        }
+        else
+        {
+            version[v] = pt_delete(version[v - 1], key, &status);
+            wrong += status != (member[v][key] ? SUCCESS : DATA_NOT_FOUND);
+        }
+        member[v][key] = insert;
+    }
+    CHECK(wrong == 0);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int v = 0; v < VERSIONS; v++)
+        {
+            if (pass && v % 2 == 0)
+                continue;
+            size_t live = 0;
+            for (int key = 0; key < KEYS; key++)
+            {
+                live += member[v][key];
+                wrong += (pt_search(version[v], key) == SUCCESS) != member[v][key];
+            }
+            count = 0;
+            invalid += (version[v] && version[v]->color != BLACK) ||
+                       check_pnode(version[v], -1, KEYS, &count) < 0 || count != live;
+        }
+        // Drop the even versions, newest first, then recheck the rest
+        for (int v = VERSIONS - 2; !pass && v >= 0; v -= 2)
+            pt_release(version[v]);
+    }
+    CHECK(wrong == 0);
+    CHECK(invalid == 0);
+    for (int v = 1; v < VERSIONS; v += 2)
+        pt_release(version[v]);
+}
+
+/**
+ * struct Reader - Arguments and result of one reader thread
+ * @pt      : Shared tree
+ * @slot    : Reader slot
+ * @stop    : Set by the main thread when the writer is done
+ * @invalid : Snapshots that were not valid trees
+ */
+typedef struct Reader
+{
+    PTree *pt;
+    int slot;
+    atomic_int *stop;
+    int invalid;
+} Reader;
+
+/* --------------------------------------------------------------------
+ * Helper Function: reader_main()
+ * Description: Validates snapshot after snapshot until told to stop.
+ * --------------------------------------------------------------------*/
+static void *reader_main(void *arg)
+{
+    Reader *r = arg;
+
+    while (!atomic_load(r->stop))
+    {
+        size_t count = 0;
+        PNode *root = ptree_read_begin(r->pt, r->slot);
+        r->invalid += check_pnode(root, -1, KEYS, &count) < 0;
+        ptree_read_end(r->pt, r->slot);
+    }
+    return NULL;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_concurrent()
+ * Description: One writer churns the tree while readers validate
+ *              lock-free snapshots; retired versions are reclaimed
+ *              under them.
+ * --------------------------------------------------------------------*/
+static void test_concurrent(void)
+{
+    PTree pt;
+    pthread_t tid[READERS];
+    Reader reader[READERS];
+    atomic_int stop = 0;
+    int invalid = 0;
+    size_t found = 0;
+
+    CHECK(ptree_init(&pt) == SUCCESS);
+    for (int i = 0; i < READERS; i++)
+    {
+        reader[i] = (Reader){ &pt, i, &stop, 0 };
+        pthread_create(&tid[i], NULL, reader_main, &reader[i]);
+    }
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = (int)((i * 7919L) % KEYS);
+        if (i % 3 == 2)
+            ptree_delete(&pt, key);
+        else
+            ptree_insert(&pt, key);
+    }
+    atomic_store(&stop, 1);
+    for (int i = 0; i < READERS; i++)
+    {
+        pthread_join(tid[i], NULL);
+        invalid += reader[i].invalid;
+    }
+    CHECK(invalid == 0);
+
+    CHECK(ptree_insert(&pt, KEYS + 1) == SUCCESS);
+    CHECK(ptree_insert(&pt, KEYS + 1) == DUPLICATE);
+    CHECK(ptree_delete(&pt, KEYS + 1) == SUCCESS);
+    CHECK(ptree_delete(&pt, KEYS + 1) == DATA_NOT_FOUND);
+    PNode *root = ptree_read_begin(&pt, 0);
+    size_t count = 0;
+    CHECK(check_pnode(root, -1, KEYS, &count) > 0);
+    for (int key = 0; key < KEYS; key++)
+        found += pt_search(root, key) == SUCCESS;
+    CHECK(found == count);
+    ptree_read_end(&pt, 0);
+    CHECK(ptree_destroy(&pt) == SUCCESS);
+}
+
+int main(void)
+{
+    test_versions();
+    test_concurrent();
+    return test_done("test_ptree");
+}
@@ -0,0 +1,173 @@
+/***********************************************************************
+ *  File Name   : test_shard.c
+ *  Description : Regression tests for the key-range sharded tree
+ *                (shard.c): status codes, range scans, rebalancing of
+ *                skewed input, and concurrent writers racing readers
+ *                and automatic rebalances.
+ *
+ *  Functions:
+ *      - check_shards()
+ *      - test_single_thread()
+ *      - writer_main()
+ *      - test_concurrent()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../shard.h"
+
+#define SHARDS 8
+#define WRITERS 4
+#define PER_WRITER 20000
+
+/* --------------------------------------------------------------------
+ * Helper Function: check_shards()
+ * Description: Every shard is a valid tree of @count keys, all inside
+ *              its range. Returns the total number of keys, or -1.
+ * --------------------------------------------------------------------*/
+static long check_shards(ShardedTree *st)
+{
+    long total = 0;
+
+    for (size_t i = 0; i < st->nshards; i++)
+    {
+        Shard *shard = &st->shards[i];
+        size_t count;
+        int lo = atomic_load(&st->lower[i]);
+
+        if (check_tree(shard->root, &count) != SUCCESS || count != shard->count)
+            return -1;
+        if (shard->root && findmin(shard->root)->data < lo)
+            return -1;
+        if (i + 1 < st->nshards && shard->root)
+        {
+            Tree *max = shard->root;
+            while (max->right)
+                max = max->right;
+            if (max->data >= atomic_load(&st->lower[i + 1]))
+                return -1;
+        }
+        total += (long)count;
+    }
+    return total;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_single_thread()
+ * Description: Status codes (an absent key is DATA_NOT_FOUND whether
+ *              or not its shard is empty), ordered range scans, and a
+ *              skewed key set spread out by rebalancing.
+ * --------------------------------------------------------------------*/
+static void test_single_thread(void)
+{
+    ShardedTree st;
+    static int out[5000];
+    int wrong = 0;
+
+    CHECK(shard_init(&st, 0) == FAILURE);
+    CHECK(shard_init(&st, SHARDS) == SUCCESS);
+    CHECK(shard_delete(&st, 7) == DATA_NOT_FOUND);          // empty shard
+    CHECK(shard_insert(&st, 7) == SUCCESS);
+    CHECK(shard_insert(&st, 7) == DUPLICATE);
+    CHECK(shard_delete(&st, 8) == DATA_NOT_FOUND);          // same shard
+    CHECK(shard_delete(&st, INT_MIN) == DATA_NOT_FOUND);    // other, empty
+    CHECK(shard_delete(&st, 7) == SUCCESS);
+    CHECK(shard_search(&st, 7) == DATA_NOT_FOUND);
+
+    // All keys land in one of the initial ranges until a rebalance
+    for (int i = 0; i < 5000; i++)
+        wrong += shard_insert(&st, (int)((i * 7919L) % 5000)) != SUCCESS;
+    CHECK(wrong == 0);
+    CHECK(check_shards(&st) == 5000);
+    CHECK(shard_rebalance(&st) == SUCCESS);
+    CHECK(check_shards(&st) == 5000);
+    size_t busiest = 0;
+    for (size_t i = 0; i < st.nshards; i++)
+        if (st.shards[i].count > busiest)
+            busiest = st.shards[i].count;
+    CHECK(busiest <= 5000 / SHARDS + 1);
+
+    size_t got = shard_range(&st, -10, 5010, out, 5000);
+    for (size_t i = 0; i < got; i++)
+        wrong += out[i] != (int)i;
+    CHECK(got == 5000 && wrong == 0);
+    CHECK(shard_range(&st, 100, 199, out, 50) == 50 && out[49] == 149);
+    CHECK(shard_range(&st, 10, 9, out, 50) == 0);
+
+    for (int i = 0; i < 5000; i += 2)
+        wrong += shard_delete(&st, i) != SUCCESS;
+    CHECK(wrong == 0);
+    CHECK(check_shards(&st) == 2500);
+    CHECK(shard_destroy(&st) == SUCCESS);
+}
+
+/**
+ * struct Writer - Arguments of one writer thread
+ * @st   : Shared tree
+ * @base : First key of the writer's own block
+ */
+typedef struct Writer
+{
+    ShardedTree *st;
+    int base;
+} Writer;
+
+/* --------------------------------------------------------------------
+ * Helper Function: writer_main()
+ * Description: Inserts its PER_WRITER keys, deletes every other one,
+ *              and scans a range after each hundred ops.
+ * --------------------------------------------------------------------*/
+static void *writer_main(void *arg)
+{
+    Writer *w = arg;
+    int out[64];
+
+    for (int i = 0; i < PER_WRITER; i++)
+    {
+        shard_insert(w->st, w->base + i);
+        if (i % 2)
+            shard_delete(w->st, w->base + i - 1);
+        if (i % 100 == 0)
+            shard_range(w->st, w->base, w->base + 1000, out, 64);
+    }
+    return NULL;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_concurrent()
+ * Description: Writers on adjacent key blocks, all inside one initial
+ *              range, so automatic rebalances race their updates.
+ * --------------------------------------------------------------------*/
+static void test_concurrent(void)
+{
+    ShardedTree st;
+    pthread_t tid[WRITERS];
+    Writer w[WRITERS];
+    int wrong = 0;
+
+    shard_init(&st, SHARDS);
+    for (int t = 0; t < WRITERS; t++)
+    {
+        w[t].st = &st;
+        w[t].base = t * PER_WRITER;
+        pthread_create(&tid[t], NULL, writer_main, &w[t]);
+    }
+    for (int t = 0; t < WRITERS; t++)
+        pthread_join(tid[t], NULL);
+
+    CHECK(check_shards(&st) == WRITERS * PER_WRITER / 2);
+    for (int key = 0; key < WRITERS * PER_WRITER; key++)
+        wrong += (shard_search(&st, key) == SUCCESS) != (key % 2);
+    CHECK(wrong == 0);
+    shard_destroy(&st);
+}
+
+int main(void)
+{
+    test_single_thread();
+    test_concurrent();
+    return test_done("test_shard");
+}
@@ -0,0 +1,133 @@
+/***********************************************************************
+ *  File Name   : test_stats.c
+ *  Description : Regression tests for the hot-path counters
+ *                (RB_STATS): allocation and free counts must match the
+ *                work done, counters are per thread, and set operations
+ *                include the work of their worker threads.
+ *
+ *  Functions:
+ *      - test_counts()
+ *      - count_thread()
+ *      - test_per_thread()
+ *      - test_set_op_workers()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <pthread.h>
+#include "test.h"
+
+#define KEYS 10000
+#define SET_KEYS 200000
+
+#ifdef RB_STATS
+/* --------------------------------------------------------------------
+ * Helper Function: test_counts()
+ * Description: Inserts and deletes KEYS keys; the counters must add up
+ *              and reset_stats() must clear them.
+ * --------------------------------------------------------------------*/
+static void test_counts(void)
+{
+    Tree *root = NULL;
+    RBStats stats;
+
+    CHECK(get_stats(NULL) == FAILURE);
+    reset_stats();
+    for (int i = 0; i < KEYS; i++)
+        insert_node(&root, i);
+    insert_node(&root, 0);                      // a duplicate allocates nothing
+    CHECK(get_stats(&stats) == SUCCESS);
+    CHECK(stats.node_allocs == KEYS && stats.node_frees == 0);
+    CHECK(stats.insert_fixups > 0 && stats.left_rotations > 0);
+    CHECK(stats.comparisons >= KEYS);
+
+    reset_stats();
+    for (int i = 0; i < KEYS; i++)
+        delete_node(&root, (int)((i * 7919L) % KEYS));
+    get_stats(&stats);
+    CHECK(stats.node_frees == KEYS && stats.node_allocs == 0);
+    CHECK(stats.double_black > 0 && stats.double_black_max <= stats.double_black);
+    CHECK(stats.double_black_max <= 2 * 14);    // at most the height of the tree
+
+    reset_stats();
+    get_stats(&stats);
+    CHECK(stats.comparisons == 0 && stats.double_black_max == 0);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: count_thread()
+ * Description: Builds and frees a tree of its own, returning whether
+ *              its counters saw exactly that work.
+ * --------------------------------------------------------------------*/
+static void *count_thread(void *arg)
+{
+    Tree *root = NULL;
+    RBStats stats;
+
+    (void)arg;
+    for (int i = 0; i < 100; i++)
+        insert_node(&root, i);
+    delete_tree(&root);
+    get_stats(&stats);
+    return (void *)(uintptr_t)(stats.node_allocs == 100 && stats.node_frees == 100);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_per_thread()
+ * Description: Another thread's work stays out of this thread's
+ *              counters, and starts from zero in its own.
+ * --------------------------------------------------------------------*/
+static void test_per_thread(void)
+{
+    pthread_t tid;
+    void *ok = NULL;
+    RBStats stats;
+
+    reset_stats();
+    pthread_create(&tid, NULL, count_thread, NULL);
+    pthread_join(tid, &ok);
+    get_stats(&stats);
+    CHECK(ok != NULL);
+    CHECK(stats.node_allocs == 0 && stats.node_frees == 0);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_set_op_workers()
+ * Description: Intersecting two disjoint trees frees every node, most
+ *              of them on worker threads; all must be counted.
+ * --------------------------------------------------------------------*/
+static void test_set_op_workers(void)
+{
+    static int even[SET_KEYS], odd[SET_KEYS];
+    RBStats stats;
+
+    for (int i = 0; i < SET_KEYS; i++)
+    {
+        even[i] = 2 * i;
+        odd[i] = 2 * i + 1;
+    }
+    Tree *a = build_from_sorted(even, SET_KEYS);
+    Tree *b = build_from_sorted(odd, SET_KEYS);
+
+    reset_stats();
+    Tree *result = intersect_trees(a, b);
+    get_stats(&stats);
+    CHECK(result == NULL);
+    CHECK(stats.node_frees == 2 * SET_KEYS && stats.node_allocs == 0);
+}
+#endif
+
+int main(void)
+{
+#ifdef RB_STATS
+    test_counts();
+    test_per_thread();
+    test_set_op_workers();
+    return test_done("test_stats");
+#else
+    printf("test_stats: skipped (needs -DRB_STATS)\n");
+    return EXIT_SUCCESS;
+#endif
+}
@@ -0,0 +1,173 @@
+/***********************************************************************
+ *  File Name   : test_store.c
+ *  Description : Regression tests for the binary tree files (store.c):
+ *                a saved tree loads back with its exact shape and
+ *                colors, a mapped file answers like the tree, and
+ *                truncated or corrupt files are rejected cleanly.
+ *
+ *  Functions:
+ *      - same_shape()
+ *      - write_raw()
+ *      - test_round_trip()
+ *      - test_mapped()
+ *      - test_corrupt()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+#include "../store.h"
+
+#define KEYS 5000
+#define CHAIN (RB_MAX_HEIGHT + 1)
+
+/* --------------------------------------------------------------------
+ * Helper Function: same_shape()
+ * Description: Returns 1 if both subtrees have the same shape, keys
+ *              and colors.
+ * --------------------------------------------------------------------*/
+static int same_shape(Tree *a, Tree *b)
+{
+    if (a == NULL || b == NULL)
+        return a == b;
+    return a->data == b->data && NODE_COLOR(a) == NODE_COLOR(b) &&
+           same_shape(a->left, b->left) && same_shape(a->right, b->right);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: write_raw()
+ * Description: Writes a header claiming @count records, then @bytes
+ *              bytes of @records, to @path.
+ * --------------------------------------------------------------------*/
+static void write_raw(const char *path, uint64_t count, const TreeRecord *records, size_t bytes)
+{
+    TreeFileHeader header = { STORE_MAGIC, STORE_BYTE_ORDER, count };
+    FILE *fp = fopen(path, "wb");
+
+    if (fp == NULL)
+        return;
+    fwrite(&header, sizeof(header), 1, fp);
+    fwrite(records, 1, bytes, fp);
+    fclose(fp);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_round_trip()
+ * Description: Random and empty trees, loaded with malloc'd and with
+ *              pooled nodes.
+ * --------------------------------------------------------------------*/
+static void test_round_trip(void)
+{
+    char path[64];
+    Tree *root = NULL, *copy = NULL;
+    NodePool pool;
+    size_t count;
+
+    test_path(path, sizeof(path), "store");
+    CHECK(save_tree(NULL, path) == SUCCESS);
+    CHECK(load_tree(path, &copy) == SUCCESS && copy == NULL);
+
+    srand(5);
+    for (int i = 0; i < KEYS; i++)
+        insert_node(&root, rand() % (4 * KEYS) - 2 * KEYS);
+    for (int i = 0; i < KEYS; i += 3)
+        delete_node(&root, i);
+    CHECK(save_tree(root, path) == SUCCESS);
+
+    CHECK(load_tree(path, &copy) == SUCCESS);
+    CHECK(check_tree(copy, &count) == SUCCESS && same_shape(root, copy));
+    CHECK(insert_node(&copy, 4 * KEYS) == SUCCESS && check_tree(copy, NULL) == SUCCESS);
+    delete_tree(&copy);
+
+    pool_init(&pool, 0);
+    CHECK(load_tree_pool(path, &copy, &pool) == SUCCESS && same_shape(root, copy));
+    pool_destroy(&pool, &copy);
+
+    CHECK(load_tree("/nonexistent/rbtree_store", &copy) == FAILURE);
+    delete_tree(&root);
+    remove(path);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_mapped()
+ * Description: mapped_search() must agree with search_node() on every
+ *              key and the gaps around them.
+ * --------------------------------------------------------------------*/
+static void test_mapped(void)
+{
+    char path[64];
+    Tree *root = NULL;
+    MappedTree map;
+    int wrong = 0;
+
+    test_path(path, sizeof(path), "store_map");
+    for (int i = 0; i < KEYS; i++)
+        insert_node(&root, (int)((i * 7919L) % KEYS) * 2);
+    save_tree(root, path);
+
+    CHECK(map_tree(path, &map) == SUCCESS && map.count == KEYS);
+    for (int key = -3; key < 2 * KEYS + 3; key++)
+        wrong += mapped_search(&map, key) != search_node(root, key);
+    CHECK(wrong == 0);
+    CHECK(unmap_tree(&map) == SUCCESS && unmap_tree(&map) == FAILURE);
+    delete_tree(&root);
+    remove(path);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_corrupt()
+ * Description: Bad magic, a truncated file, a right offset past the
+ *              end and a chain deeper than RB_MAX_HEIGHT all fail,
+ *              leaving *root NULL (and, under ASan, leaking nothing).
+ * --------------------------------------------------------------------*/
+static void test_corrupt(void)
+{
+    char path[64];
+    TreeRecord records[CHAIN];
+    Tree *root = NULL;
+    MappedTree map;
+
+    test_path(path, sizeof(path), "store_bad");
+
+    // Three nodes: 2 (BLACK) with children 1 and 3 (RED)
+    records[0] = (TreeRecord){ 2, (2u << 2) | RECORD_HAS_LEFT | RECORD_COLOR };
+    records[1] = (TreeRecord){ 1, 0 };
+    records[2] = (TreeRecord){ 3, 0 };
+    write_raw(path, 3, records, 3 * sizeof(TreeRecord));
+    CHECK(load_tree(path, &root) == SUCCESS && check_tree(root, NULL) == SUCCESS);
+    delete_tree(&root);
+
+    write_raw(path, 3, records, 3 * sizeof(TreeRecord) - 1);
+    CHECK(map_tree(path, &map) == FAILURE && load_tree(path, &root) == FAILURE);
+
+    records[0].link = (3u << 2) | RECORD_HAS_LEFT | RECORD_COLOR;
+    write_raw(path, 3, records, 3 * sizeof(TreeRecord));
+    CHECK(load_tree(path, &root) == FAILURE && root == NULL);
+    CHECK(map_tree(path, &map) == SUCCESS);
+    CHECK(mapped_search(&map, 4) == DATA_NOT_FOUND);   // terminates anyway
+    unmap_tree(&map);
+
+    for (int i = 0; i < CHAIN; i++)
+        records[i] = (TreeRecord){ CHAIN - i, i + 1 < CHAIN ? RECORD_HAS_LEFT : 0 };
+    write_raw(path, CHAIN, records, sizeof(records));
+    CHECK(load_tree(path, &root) == FAILURE && root == NULL);
+
+    FILE *fp = fopen(path, "r+b");
+    if (fp)
+    {
+        fputc('X', fp);
+        fclose(fp);
+    }
+    CHECK(map_tree(path, &map) == FAILURE);
+    remove(path);
+}
+
+int main(void)
+{
+    test_round_trip();
+    test_mapped();
+    test_corrupt();
+    return test_done("test_store");
+}
@@ -0,0 +1,126 @@
+/***********************************************************************
+ *  File Name   : test_topdown.c
+ *  Description : Regression tests for the single-pass top-down insert
+ *                and delete (topdown.c): random workloads checked
+ *                against a reference membership table, mixed with the
+ *                bottom-up operations on the same tree.
+ *
+ *  Functions:
+ *      - run_random()
+ *      - test_status_codes()
+ *      - test_mixed_with_bottom_up()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+
+#define KEYS 3000
+#define OPS 60000
+
+/* --------------------------------------------------------------------
+ * Helper Function: run_random()
+ * Description: Runs OPS random top-down inserts and deletes over keys
+ *              0..KEYS-1 (nodes from @pool), checking each status and
+ *              the whole tree every thousand ops.
+ * --------------------------------------------------------------------*/
+static void run_random(NodePool *pool, unsigned int seed)
+{
+    static char present[KEYS];
+    Tree *root = NULL;
+    int wrong = 0, invalid = 0;
+    size_t count, live = 0;
+
+    memset(present, 0, sizeof(present));
+    srand(seed);
+    for (int i = 0; i < OPS; i++)
+    {
+        int key = rand() % KEYS;
+
+        if (rand() % 2)
+        {
+            int flag = insert_node_topdown_pool(&root, key, pool);
+            wrong += flag != (present[key] ? DUPLICATE : SUCCESS);
+            live += !present[key];
+            present[key] = 1;
+        }
+        else
+        {
+            int flag = delete_node_topdown_pool(&root, key, pool);
+            wrong += flag != (present[key] ? SUCCESS
+                                           : root ? DATA_NOT_FOUND : FAILURE);
+            live -= present[key];
+            present[key] = 0;
+        }
+        if (i % 1000 == 0)
+            invalid += check_tree(root, &count) != SUCCESS || count != live;
+    }
+    CHECK(wrong == 0);
+    CHECK(invalid == 0);
+
+    for (int key = 0; key < KEYS; key++)
+        wrong += (search_node(root, key) == SUCCESS) != present[key];
+    CHECK(wrong == 0);
+
+    if (pool)
+        pool_destroy(pool, &root);
+    else
+        delete_tree(&root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_status_codes()
+ * Description: Edge cases: empty tree, duplicate, absent key, and
+ *              deleting down to an empty tree.
+ * --------------------------------------------------------------------*/
+static void test_status_codes(void)
+{
+    Tree *root = NULL;
+
+    CHECK(delete_node_topdown(&root, 1) == FAILURE);
+    CHECK(insert_node_topdown(&root, 1) == SUCCESS);
+    CHECK(insert_node_topdown(&root, 1) == DUPLICATE);
+    CHECK(delete_node_topdown(&root, 2) == DATA_NOT_FOUND);
+    CHECK(insert_node_topdown(&root, INT_MIN) == SUCCESS);
+    CHECK(insert_node_topdown(&root, INT_MAX) == SUCCESS);
+    CHECK(check_tree(root, NULL) == SUCCESS);
+    CHECK(delete_node_topdown(&root, 1) == SUCCESS);
+    CHECK(delete_node_topdown(&root, INT_MIN) == SUCCESS);
+    CHECK(delete_node_topdown(&root, INT_MAX) == SUCCESS);
+    CHECK(root == NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_mixed_with_bottom_up()
+ * Description: Top-down results must stay usable by every other
+ *              operation: alternate both kinds of insert and delete.
+ * --------------------------------------------------------------------*/
+static void test_mixed_with_bottom_up(void)
+{
+    Tree *root = NULL;
+    size_t count;
+
+    for (int i = 0; i < 4000; i++)
+        (i % 2 ? insert_node : insert_node_topdown)(&root, (int)((i * 7919L) % 4000));
+    CHECK(check_tree(root, &count) == SUCCESS && count == 4000);
+
+    for (int i = 0; i < 4000; i += 2)
+        (i % 4 ? delete_node : delete_node_topdown)(&root, i);
+    CHECK(check_tree(root, &count) == SUCCESS && count == 2000);
+    CHECK(search_node(root, 1) == SUCCESS && search_node(root, 2) == DATA_NOT_FOUND);
+    delete_tree(&root);
+}
+
+int main(void)
+{
+    NodePool pool;
+
+    test_status_codes();
+    run_random(NULL, 1);
+    pool_init(&pool, 0);
+    run_random(&pool, 2);
+    test_mixed_with_bottom_up();
+    return test_done("test_topdown");
+}
@@ -0,0 +1,197 @@
+/***********************************************************************
+ *  File Name   : test_tree.c
+ *  Description : Regression tests for the core tree operations
+ *                (tree.c): insert, delete and search against a
+ *                reference table, the interleaved search_many(), and
+ *                the iterative teardown and printing.
+ *
+ *  Functions:
+ *      - test_random_ops()
+ *      - test_search_many()
+ *      - test_teardown()
+ *      - node_depth()
+ *      - test_print()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "test.h"
+
+#define KEYS 4000
+#define OPS 80000
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_random_ops()
+ * Description: Random inserts and deletes, each status and the whole
+ *              tree checked along the way.
+ * --------------------------------------------------------------------*/
+static void test_random_ops(void)
+{
+    static char present[KEYS];
+    Tree *root = NULL;
+    int wrong = 0, invalid = 0;
+    size_t count, live = 0;
+
+    CHECK(delete_node(&root, 0) == FAILURE);
+    CHECK(search_node(root, 0) == DATA_NOT_FOUND);
+    srand(3);
+    for (int i = 0; i < OPS; i++)
+    {
+        int key = rand() % KEYS;
+
+        if (rand() % 2)
+        {
+            wrong += insert_node(&root, key) != (present[key] ? DUPLICATE : SUCCESS);
+            live += !present[key];
+            present[key] = 1;
+        }
+        else
+        {
+            wrong += delete_node(&root, key) != (present[key] ? SUCCESS
+                                                 : root ? DATA_NOT_FOUND : FAILURE);
+            live -= present[key];
+            present[key] = 0;
+        }
+        if (i % 1000 == 0)
+            invalid += check_tree(root, &count) != SUCCESS || count != live;
+    }
+    CHECK(wrong == 0);
+    CHECK(invalid == 0);
+    for (int key = 0; key < KEYS; key++)
+        wrong += (search_node(root, key) == SUCCESS) != present[key];
+    CHECK(wrong == 0);
+    CHECK(delete_tree(&root) == SUCCESS && root == NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_search_many()
+ * Description: Batches shorter than, equal to and longer than
+ *              SEARCH_GROUP, mixing hits and misses, must match
+ *              search_node() key by key.
+ * --------------------------------------------------------------------*/
+static void test_search_many(void)
+{
+    static const size_t sizes[] = { 0, 1, SEARCH_GROUP - 1, SEARCH_GROUP,
+                                    SEARCH_GROUP + 1, 1000 };
+    static int keys[1000], results[1000];
+    Tree *root = NULL;
+    int wrong = 0;
+
+    for (int i = 0; i < 1000; i += 2)
+        insert_node(&root, i);
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        for (size_t i = 0; i < sizes[s]; i++)
+        {
+            keys[i] = (int)((i * 7919) % 1200) - 100;
+            results[i] = 1;
+        }
+        wrong += search_many(root, keys, sizes[s], results) != SUCCESS;
+        for (size_t i = 0; i < sizes[s]; i++)
+            wrong += results[i] != search_node(root, keys[i]);
+    }
+    CHECK(wrong == 0);
+
+    CHECK(search_many(NULL, keys, 3, results) == SUCCESS && results[0] == DATA_NOT_FOUND);
+    CHECK(search_many(root, NULL, 3, results) == FAILURE);
+    CHECK(search_many(root, keys, 3, NULL) == FAILURE);
+    delete_tree(&root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_teardown()
+ * Description: delete_tree() empties any tree; delete_tree_pool()
+ *              hands every node back, so rebuilding the same tree
+ *              needs no new slab. Under ASan a missed node leaks.
+ * --------------------------------------------------------------------*/
+static void test_teardown(void)
+{
+    Tree *root = NULL;
+    NodePool pool;
+
+    CHECK(delete_tree(&root) == SUCCESS && root == NULL);
+    for (int i = 0; i < OPS; i++)
+        insert_node(&root, (int)((i * 7919L) % OPS));
+    CHECK(delete_tree(&root) == SUCCESS && root == NULL);
+
+    pool_init(&pool, 0);
+    for (int i = 0; i < OPS; i++)
+        insert_node_pool(&root, i, &pool);
+    Slab *slabs = pool.slabs;
+    CHECK(delete_tree_pool(&root, &pool) == SUCCESS && root == NULL);
+    for (int i = 0; i < OPS; i++)
+        insert_node_pool(&root, -i, &pool);
+    CHECK(pool.slabs == slabs && check_tree(root, NULL) == SUCCESS);
+    pool_destroy(&pool, &root);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: node_depth()
+ * Description: Depth of the node holding @data (the root is 1).
+ * --------------------------------------------------------------------*/
+static int node_depth(Tree *root, int data)
+{
+    int depth = 1;
+
+    while (root && root->data != data)
+    {
+        root = data < root->data ? root->left : root->right;
+        depth++;
+    }
+    return depth;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_print()
+ * Description: print_tree() output, captured from stdout, lists every
+ *              key once in descending order, indented by its depth.
+ * --------------------------------------------------------------------*/
+static void test_print(void)
+{
+    char path[64], line[256];
+    Tree *root = NULL;
+    int saved, key, wrong = 0, printed = 0, expect = 998;
+    FILE *out = fopen(test_path(path, sizeof(path), "print"), "w+");
+
+    CHECK(out != NULL);
+    if (out == NULL)
+        return;
+    for (int i = 0; i < 500; i++)
+        insert_node(&root, (int)((i * 7919L) % 500) * 2);
+
+    fflush(stdout);
+    saved = dup(STDOUT_FILENO);
+    dup2(fileno(out), STDOUT_FILENO);
+    print_tree(root, 3);
+    print_tree(NULL, 3);
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+
+    rewind(out);
+    while (fgets(line, sizeof(line), out))
+    {
+        int spaces = (int)strspn(line, " ");
+        if (sscanf(line + spaces, "%d(", &key) != 1)
+            continue;
+        wrong += key != expect || spaces != 3 + node_depth(root, key) * SPACE_STEP;
+        expect -= 2;
+        printed++;
+    }
+    CHECK(wrong == 0 && printed == 500);
+    fclose(out);
+    remove(path);
+    delete_tree(&root);
+}
+
+int main(void)
+{
+    test_random_ops();
+    test_search_many();
+    test_teardown();
+    test_print();
+    return test_done("test_tree");
+}
@@ -0,0 +1,266 @@
+/***********************************************************************
+ *  File Name   : test_wal.c
+ *  Description : Regression tests for the write-ahead logged tree
+ *                (wal.c): what a Wal held when closed comes back on
+ *                reopen, from the log, from checkpoints or both; a torn
+ *                log tail is cut off; and concurrent writers sharing
+ *                group commits lose nothing.
+ *
+ *  Functions:
+ *      - file_size()
+ *      - matches()
+ *      - test_recovery()
+ *      - test_torn_tail()
+ *      - test_checkpoints()
+ *      - writer_main()
+ *      - test_group_commit()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <sys/stat.h>
+#include "test.h"
+#include "../wal.h"
+
+#define KEYS 1000
+#define WRITERS 4
+#define PER_WRITER 500
+
+static char log_path[64], ckpt_path[64];
+
+/* --------------------------------------------------------------------
+ * Helper Function: file_size()
+ * Description: Size of @path in bytes, or -1 if it does not exist.
+ * --------------------------------------------------------------------*/
+static long file_size(const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 ? (long)st.st_size : -1;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: matches()
+ * Description: Returns 1 if the Wal's tree is valid and holds exactly
+ *              the keys k in [0, @n) with present[k].
+ * --------------------------------------------------------------------*/
+static int matches(Wal *wal, const char *present, int n)
+{
+    size_t count, live = 0;
+
+    if (check_tree(wal->root, &count) != SUCCESS)
+        return 0;
+    for (int k = 0; k < n; k++)
+    {
+        if ((wal_search(wal, k) == SUCCESS) != present[k])
+            return 0;
+        live += present[k];
+    }
+    return count == live;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_recovery()
+ * Description: Random inserts and deletes, statuses checked, survive
+ *              close and reopen from the log alone.
+ * --------------------------------------------------------------------*/
+static void test_recovery(void)
+{
+    static char present[KEYS];
+    Wal wal;
+    int wrong = 0;
+
+    remove(log_path);
+    remove(ckpt_path);
+    CHECK(wal_open(&wal, log_path, ckpt_path, NULL) == SUCCESS && wal.root == NULL);
+    srand(23);
+    for (int i = 0; i < 3 * KEYS; i++)
+    {
+        int key = rand() % KEYS;
+        if (rand() % 3)
+        {
+            wrong += wal_insert(&wal, key) != (present[key] ? DUPLICATE : SUCCESS);
+            present[key] = 1;
+        }
+        else
+        {
+            wrong += wal_delete(&wal, key) != (present[key] ? SUCCESS
+                                               : wal.root ? DATA_NOT_FOUND : FAILURE);
+            present[key] = 0;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(wal_close(&wal) == SUCCESS);
+    CHECK(file_size(ckpt_path) == -1);
+
+    CHECK(wal_open(&wal, log_path, ckpt_path, NULL) == SUCCESS);
+    CHECK(matches(&wal, present, KEYS));
+    CHECK(wal_close(&wal) == SUCCESS);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_torn_tail()
+ * Description: A half-written record and one failing its check are
+ *              dropped on reopen and cut from the log; a file that is
+ *              not a log is refused.
+ * --------------------------------------------------------------------*/
+static void test_torn_tail(void)
+{
+    Wal wal;
+    WalRecord bad = { 7, WAL_OP_INSERT, 0 };
+    FILE *fp;
+
+    remove(log_path);
+    remove(ckpt_path);
+    wal_open(&wal, log_path, ckpt_path, NULL);
+    wal_insert(&wal, 1);
+    wal_insert(&wal, 2);
+    wal_close(&wal);
+    long size = file_size(log_path);
+    CHECK(size == (long)(sizeof(WalFileHeader) + 2 * sizeof(WalRecord)));
+
+    bad.check = (uint16_t)(WAL_CHECK(bad.data, bad.op) + 1);
+    fp = fopen(log_path, "ab");
+    fwrite(&bad, sizeof(bad), 1, fp);
+    fwrite(&bad, 3, 1, fp);
+    fclose(fp);
+    CHECK(wal_open(&wal, log_path, ckpt_path, NULL) == SUCCESS);
+    CHECK(wal_search(&wal, 1) == SUCCESS && wal_search(&wal, 2) == SUCCESS &&
+          wal_search(&wal, 7) == DATA_NOT_FOUND);
+    CHECK(file_size(log_path) == size);
+    CHECK(wal_insert(&wal, 3) == SUCCESS);
+    wal_close(&wal);
+    CHECK(wal_open(&wal, log_path, ckpt_path, NULL) == SUCCESS && wal_search(&wal, 3) == SUCCESS);
+    wal_close(&wal);
+
+    fp = fopen(log_path, "r+b");
+    fputc('X', fp);
+    fclose(fp);
+    CHECK(wal_open(&wal, log_path, ckpt_path, NULL) == FAILURE);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_checkpoints()
+ * Description: Automatic checkpoints every 100 records keep the log
+ *              short; an explicit one empties it; recovery combines the
+ *              checkpoint with the log written after it.
+ * --------------------------------------------------------------------*/
+static void test_checkpoints(void)
+{
+    static char present[KEYS];
+    Wal wal;
+    NodePool pool;
+
+    remove(log_path);
+    remove(ckpt_path);
+    pool_init(&pool, 0);
+    CHECK(wal_open(&wal, log_path, ckpt_path, &pool) == SUCCESS);
+    pthread_mutex_lock(&wal.lock);
+    wal.checkpoint_every = 100;
+    pthread_mutex_unlock(&wal.lock);
+
+    for (int k = 0; k < KEYS; k++)
+    {
+        wal_insert(&wal, k);
+        present[k] = 1;
+    }
+    CHECK(wal_checkpoint(&wal) == SUCCESS);
+    CHECK(file_size(log_path) == (long)sizeof(WalFileHeader) && file_size(ckpt_path) > 0);
+
+    for (int k = 0; k < KEYS; k += 3)
+    {
+        wal_delete(&wal, k);
+        present[k] = 0;
+    }
+    CHECK(wal_close(&wal) == SUCCESS);
+    CHECK(file_size(log_path) < (long)(sizeof(WalFileHeader) + KEYS / 3 * sizeof(WalRecord)));
+
+    CHECK(wal_open(&wal, log_path, ckpt_path, &pool) == SUCCESS);
+    CHECK(matches(&wal, present, KEYS));
+    CHECK(wal_close(&wal) == SUCCESS);
+    pool_destroy(&pool, NULL);
+}
+
+/**
+ * struct Writer - Arguments of one writer thread
+ * @wal   : Shared log
+ * @base  : First key of the writer's own block
+ * @wrong : Calls that did not return SUCCESS
+ */
+typedef struct Writer
+{
+    Wal *wal;
+    int base;
+    int wrong;
+} Writer;
+
+/* --------------------------------------------------------------------
+ * Helper Function: writer_main()
+ * Description: Inserts PER_WRITER keys, deleting every fourth again.
+ * --------------------------------------------------------------------*/
+static void *writer_main(void *arg)
+{
+    Writer *w = arg;
+
+    for (int i = 0; i < PER_WRITER; i++)
+    {
+        w->wrong += wal_insert(w->wal, w->base + i) != SUCCESS;
+        if (i % 4 == 3)
+            w->wrong += wal_delete(w->wal, w->base + i) != SUCCESS;
+    }
+    return NULL;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: test_group_commit()
+ * Description: Concurrent writers, with checkpoints running under
+ *              them; every acknowledged change survives reopening.
+ * --------------------------------------------------------------------*/
+static void test_group_commit(void)
+{
+    static char present[WRITERS * PER_WRITER];
+    pthread_t tid[WRITERS];
+    Writer w[WRITERS];
+    Wal wal;
+    int wrong = 0;
+
+    remove(log_path);
+    remove(ckpt_path);
+    CHECK(wal_open(&wal, log_path, ckpt_path, NULL) == SUCCESS);
+    pthread_mutex_lock(&wal.lock);
+    wal.checkpoint_every = 300;
+    pthread_mutex_unlock(&wal.lock);
+
+    for (int t = 0; t < WRITERS; t++)
+    {
+        w[t] = (Writer){ &wal, t * PER_WRITER, 0 };
+        pthread_create(&tid[t], NULL, writer_main, &w[t]);
+    }
+    for (int t = 0; t < WRITERS; t++)
+    {
+        pthread_join(tid[t], NULL);
+        wrong += w[t].wrong;
+    }
+    CHECK(wrong == 0);
+    CHECK(wal_close(&wal) == SUCCESS);
+
+    for (int k = 0; k < WRITERS * PER_WRITER; k++)
+        present[k] = k % PER_WRITER % 4 != 3;
+    CHECK(wal_open(&wal, log_path, ckpt_path, NULL) == SUCCESS);
+    CHECK(matches(&wal, present, WRITERS * PER_WRITER));
+    CHECK(wal_close(&wal) == SUCCESS);
+}
+
+int main(void)
+{
+    test_path(log_path, sizeof(log_path), "wal_log");
+    test_path(ckpt_path, sizeof(ckpt_path), "wal_ckpt");
+    test_recovery();
+    test_torn_tail();
+    test_checkpoints();
+    test_group_commit();
+    remove(log_path);
+    remove(ckpt_path);
+    return test_done("test_wal");
+}
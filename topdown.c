@@ -0,0 +1,281 @@
+/***********************************************************************
+ *  File Name   : topdown.c
+ *  Description : Single-pass, top-down insertion and deletion for the
+ *                Red-Black Tree. Colors are flipped and rotations done
+ *                on the way down, so every level is visited once and
+ *                no fixup walks back up. Nodes are reached only through
+ *                child links, with a stack sentinel above the root; the
+ *                parent links are still written (never read) so the
+ *                result stays usable by every other tree operation.
+ *
+ *                Subtree sizes cannot be kept on a single downward pass,
+ *                so with RB_ORDER_STATS these fall back to insert_node()
+ *                and delete_node().
+ *
+ *  Functions:
+ *      - is_red()
+ *      - set_link()
+ *      - rotate_single()
+ *      - rotate_double()
+ *      - insert_node_topdown() / insert_node_topdown_pool()
+ *      - delete_node_topdown() / delete_node_topdown_pool()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "tree.h"
+
+// Child of @n in direction @dir (0 = left, 1 = right), usable as an lvalue
+#define CHILD(n, dir) (*((dir) ? &(n)->right : &(n)->left))
+
+#ifndef RB_ORDER_STATS
+/* --------------------------------------------------------------------
+ * Helper Function: is_red()
+ * Description: NULL-safe RED test.
+ * --------------------------------------------------------------------*/
+static int is_red(Tree *node)
+{
+    return node && NODE_COLOR(node) == RED;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: set_link()
+ * Description: Makes @child the @dir child of @node.
+ * --------------------------------------------------------------------*/
+static void set_link(Tree *node, int dir, Tree *child)
+{
+    CHILD(node, dir) = child;
+    if (child)
+        SET_PARENT(child, node);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: rotate_single()
+ * Description: Rotates @node in direction @dir, making its opposite
+ *              child the new (BLACK) subtree root over a RED @node.
+ *              Returns the new subtree root for the caller to link.
+ * --------------------------------------------------------------------*/
+static Tree *rotate_single(Tree *node, int dir)
+{
+    Tree *save = CHILD(node, !dir);
+
+    if (dir == 0)
+        STAT_INC(left_rotations);
+    else
+        STAT_INC(right_rotations);
+
+    set_link(node, !dir, CHILD(save, dir));
+    set_link(save, dir, node);
+    SET_COLOR(node, RED);
+    SET_COLOR(save, BLACK);
+    return save;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: rotate_double()
+ * Description: Inner-grandchild case: rotates the child first, then
+ *              @node, in direction @dir.
+ * --------------------------------------------------------------------*/
+static Tree *rotate_double(Tree *node, int dir)
+{
+    set_link(node, !dir, rotate_single(CHILD(node, !dir), !dir));
+    return rotate_single(node, dir);
+}
+#endif
+
+/* --------------------------------------------------------------------
+ * Function: insert_node_topdown()
+ * Description: Same contract as insert_node(), in one downward pass.
+ * --------------------------------------------------------------------*/
+int insert_node_topdown(Tree **root, int data)
+{
+    return insert_node_topdown_pool(root, data, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: insert_node_topdown_pool()
+ * Description: Descends toward @data, splitting every node with two
+ *              RED children by a color flip and repairing any RED-RED
+ *              pair that creates with one rotation at the grandparent,
+ *              then hangs the new node at the bottom. A duplicate stops
+ *              the descent early; the tree is valid at every step.
+ * --------------------------------------------------------------------*/
+int insert_node_topdown_pool(Tree **root, int data, NodePool *pool)
+{
+#ifdef RB_ORDER_STATS
+    return insert_node_pool(root, data, pool);
+#else
+    if (*root == NULL)
+    {
+        Tree *node = create_node_pool(data, pool);
+        if (node == NULL)
+            return FAILURE;
+        SET_COLOR(node, BLACK);
+        *root = node;
+        return SUCCESS;
+    }
+
+    Tree head = { 0 };   // sentinel above the root: head.right
+    Tree *t = &head, *g = NULL, *p = NULL, *q = *root;
+    int dir = 0, last = 0, status = DUPLICATE;
+
+    head.right = *root;
+    for (;;)
+    {
+        if (q == NULL)
+        {
+            q = create_node_pool(data, pool);
+            if (q == NULL)
+            {
+                status = FAILURE;
+                break;
+            }
+            set_link(p, dir, q);
+            THREAD_ATTACH(q, p, dir);
+            status = SUCCESS;
+        }
+        else if (is_red(q->left) && is_red(q->right))
+        {
+            STAT_INC(recolors);
+            SET_COLOR(q, RED);
+            SET_COLOR(q->left, BLACK);
+            SET_COLOR(q->right, BLACK);
+        }
+
+        if (is_red(q) && is_red(p))
+        {
+            STAT_INC(insert_fixups);
+            int dir2 = (t->right == g);
+            if (q == CHILD(p, last))
+                set_link(t, dir2, rotate_single(g, !last));
+            else
+                set_link(t, dir2, rotate_double(g, !last));
+        }
+
+        STAT_INC(comparisons);
+        if (q->data == data)
+            break;
+
+        last = dir;
+        dir = q->data < data;
+        if (g)
+            t = g;
+        g = p;
+        p = q;
+        q = CHILD(q, dir);
+    }
+
+    *root = head.right;
+    SET_PARENT(*root, NULL);
+    SET_COLOR(*root, BLACK);
+    return status;
+#endif
+}
+
+/* --------------------------------------------------------------------
+ * Function: delete_node_topdown()
+ * Description: Same contract as delete_node(), in one downward pass.
+ * --------------------------------------------------------------------*/
+int delete_node_topdown(Tree **root, int data)
+{
+    return delete_node_topdown_pool(root, data, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: delete_node_topdown_pool()
+ * Description: Descends toward @data and on past it to its in-order
+ *              predecessor, pushing a RED node down ahead of the walk
+ *              (by rotation, color flip, or borrowing through the
+ *              sibling) so the node finally unlinked is always RED or
+ *              the root. The predecessor's key and per-node flags (the
+ *              RB_LAZY_DELETE tombstone bit) then move into @data's
+ *              node, so a tombstone stays dead and a live key stays
+ *              live; but unlike delete_node() this does not keep node
+ *              handles valid.
+ * --------------------------------------------------------------------*/
+int delete_node_topdown_pool(Tree **root, int data, NodePool *pool)
+{
+#ifdef RB_ORDER_STATS
+    return delete_node_pool(root, data, pool);
+#else
+    if (*root == NULL)
+        return FAILURE;
+
+    Tree head = { 0 };
+    Tree *q = &head, *p = NULL, *g = NULL, *found = NULL;
+    int dir = 1;
+
+    head.right = *root;
+    while (CHILD(q, dir))
+    {
+        int last = dir;
+
+        g = p;
+        p = q;
+        q = CHILD(q, dir);
+        STAT_INC(comparisons);
+        dir = q->data < data;
+        if (q->data == data)
+            found = q;
+
+        if (is_red(q) || is_red(CHILD(q, dir)))
+            continue;
+
+        if (is_red(CHILD(q, !dir)))
+        {
+            // Rotate the RED child up so the next level is RED
+            set_link(p, last, rotate_single(q, dir));
+            p = CHILD(p, last);
+        }
+        else
+        {
+            Tree *s = CHILD(p, !last);
+            if (s == NULL)
+                continue;
+
+            if (!is_red(s->left) && !is_red(s->right))
+            {
+                // Color flip: merge q and its sibling under p
+                STAT_INC(recolors);
+                SET_COLOR(p, BLACK);
+                SET_COLOR(s, RED);
+                SET_COLOR(q, RED);
+            }
+            else
+            {
+                // Borrow a RED nephew through the sibling
+                int dir2 = (g->right == p);
+                if (is_red(CHILD(s, last)))
+                    set_link(g, dir2, rotate_double(p, last));
+                else
+                    set_link(g, dir2, rotate_single(p, last));
+
+                Tree *top = CHILD(g, dir2);
+                SET_COLOR(q, RED);
+                SET_COLOR(top, RED);
+                SET_COLOR(top->left, BLACK);
+                SET_COLOR(top->right, BLACK);
+            }
+        }
+    }
+
+    if (found)
+    {
+        found->data = q->data;
+        SET_DEAD(found, NODE_DEAD(q));   // the flag belongs to the key
+        set_link(p, p->right == q, CHILD(q, q->left == NULL));
+        THREAD_UNLINK(q);
+        pool_free(pool, q);
+    }
+
+    *root = head.right;
+    if (*root)
+    {
+        SET_PARENT(*root, NULL);
+        SET_COLOR(*root, BLACK);
+    }
+    return found ? SUCCESS : DATA_NOT_FOUND;
+#endif
+}
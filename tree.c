@@ -16,47 +16,67 @@
  *  Functions:
  *      - right_rotate()
  *      - left_rotate()
- *      - create_node()
- *      - insert_node()
+ *      - create_node() / create_node_pool()
+ *      - insert_node() / insert_node_pool()
+ *      - insert_handle() / insert_handle_pool()
+ *      - attach_leaf()
+ *      - insert_hint() / insert_hint_pool()
+ *      - insert_fixup()
  *      - findmin()
  *      - getsibling_node()
  *      - is_left_child()
  *      - fix_double_black()
- *      - delete_node()
+ *      - delete_node() / delete_node_pool()
+ *      - swap_with_successor()
+ *      - erase_handle() / erase_handle_pool()
  *      - search_node()
- *      - delete_tree()
+ *      - search_many()
+ *      - delete_tree() / delete_tree_pool()
  *      - print_color()
  *      - print_tree()
+ *      - get_stats() / reset_stats()
+ *      - count_less()
+ *      - rank_node() / select_node() / count_range()
  *
  *  Author      : Pankaj Kumar
  *  Roll No     : 25008_018
  *  Date        : 14-Sep-2025
  ***********************************************************************/
 
+#include <string.h>
 #include "tree.h"
 
+#ifdef RB_STATS
+_Thread_local RBStats rb_stats;
+_Thread_local unsigned long rb_stats_depth;
+#endif
+
 /* --------------------------------------------------------------------
  * Function: right_rotate()
  * Description: Performs a right rotation on a given node.
  * --------------------------------------------------------------------*/
 void right_rotate(Tree **root, Tree *node)
 {
+    STAT_INC(right_rotations);
     Tree *temp = node->left;
     node->left = temp->right;
     if (temp->right != NULL)
-        temp->right->parent = node;
+        SET_PARENT(temp->right, node);
 
-    temp->parent = node->parent;
+    SET_PARENT(temp, NODE_PARENT(node));
     
-    if (node->parent == NULL)
+    if (NODE_PARENT(node) == NULL)
         *root = temp;
-    else if (node == node->parent->right)
-        node->parent->right = temp;
+    else if (node == NODE_PARENT(node)->right)
+        NODE_PARENT(node)->right = temp;
     else
-        node->parent->left = temp;
+        NODE_PARENT(node)->left = temp;
     
     temp->right = node;
-    node->parent = temp;
+    SET_PARENT(node, temp);
+
+    SIZE_UPDATE(node);
+    SIZE_UPDATE(temp);
 }
 
 /* --------------------------------------------------------------------
@@ -65,22 +85,26 @@ void right_rotate(Tree **root, Tree *node)
  * --------------------------------------------------------------------*/
 void left_rotate(Tree **root, Tree *node)
 {
+    STAT_INC(left_rotations);
     Tree *temp = node->right;
     node->right = temp->left;
     if (temp->left != NULL)
-        temp->left->parent = node;
+        SET_PARENT(temp->left, node);
 
-    temp->parent = node->parent;
+    SET_PARENT(temp, NODE_PARENT(node));
     
-    if (node->parent == NULL)
+    if (NODE_PARENT(node) == NULL)
         *root = temp;
-    else if (node == node->parent->left)
-        node->parent->left = temp;
+    else if (node == NODE_PARENT(node)->left)
+        NODE_PARENT(node)->left = temp;
     else
-        node->parent->right = temp;
+        NODE_PARENT(node)->right = temp;
     
     temp->left = node;
-    node->parent = temp;
+    SET_PARENT(node, temp);
+
+    SIZE_UPDATE(node);
+    SIZE_UPDATE(temp);
 }
 
 /* --------------------------------------------------------------------
@@ -89,15 +113,30 @@ void left_rotate(Tree **root, Tree *node)
  * --------------------------------------------------------------------*/
 Tree *create_node(int data)
 {
-    Tree *newNode = malloc(sizeof(Tree));
+    return create_node_pool(data, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: create_node_pool()
+ * Description: Same as create_node(), but takes the node from @pool
+ *              (or from malloc when @pool is NULL).
+ * --------------------------------------------------------------------*/
+Tree *create_node_pool(int data, NodePool *pool)
+{
+    Tree *newNode = pool_alloc(pool);
     if (newNode == NULL)
         return NULL;
 
     newNode->data = data;
-    newNode->parent = NULL;
+    SET_PARENT(newNode, NULL);
     newNode->left = NULL;
     newNode->right = NULL;
-    newNode->color = RED;   // New nodes are always red initially
+    SET_COLOR(newNode, RED);   // New nodes are always red initially
+    SET_DEAD(newNode, 0);
+    SIZE_UPDATE(newNode);
+#ifdef RB_THREADED
+    newNode->prev = newNode->next = NULL;
+#endif
     return newNode;
 }
 
@@ -107,91 +146,218 @@ Tree *create_node(int data)
  *              any property violations using rotations and color flips.
  * --------------------------------------------------------------------*/
 int insert_node(Tree **root, int data)
+{
+    return insert_node_pool(root, data, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: insert_node_pool()
+ * Description: Same as insert_node(), allocating the new node from @pool.
+ * --------------------------------------------------------------------*/
+int insert_node_pool(Tree **root, int data, NodePool *pool)
+{
+    Tree *handle;
+    return insert_handle_pool(root, data, &handle, pool);
+}
+
+/* --------------------------------------------------------------------
+ * Function: insert_handle()
+ * Description: Inserts @data and stores its node in *handle. The node
+ *              keeps holding @data until it is erased, so the handle
+ *              stays valid across other inserts and deletes. On
+ *              DUPLICATE *handle is the existing node; on FAILURE NULL.
+ * --------------------------------------------------------------------*/
+int insert_handle(Tree **root, int data, Tree **handle)
+{
+    return insert_handle_pool(root, data, handle, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: attach_leaf()
+ * Description: Links a new RED node holding @data as the @right (or
+ *              left) child of @parent, a NULL slot, and rebalances.
+ *              The caller vouches that @data belongs there, e.g. past
+ *              a known minimum or maximum, so no key is compared.
+ * --------------------------------------------------------------------*/
+int attach_leaf(Tree **root, Tree *parent, int right, int data,
+                       Tree **handle, NodePool *pool)
+{
+    Tree *newNode = create_node_pool(data, pool);
+    *handle = newNode;
+    if (newNode == NULL)
+        return FAILURE;
+
+    if (parent == NULL)
+    {
+        SET_COLOR(newNode, BLACK);
+        *root = newNode;
+        return SUCCESS;
+    }
+
+    SET_PARENT(newNode, parent);
+    if (right)
+        parent->right = newNode;
+    else
+        parent->left = newNode;
+    SIZE_PATH_INC(parent);
+    THREAD_ATTACH(newNode, parent, right);
+
+    insert_fixup(root, newNode);
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Function: insert_handle_pool()
+ * Description: Same as insert_handle(), allocating from @pool.
+ * --------------------------------------------------------------------*/
+int insert_handle_pool(Tree **root, int data, Tree **handle, NodePool *pool)
 {
     Tree *temp = *root, *prev = NULL;
 
     // Standard BST insertion
     while (temp)
     {
+        STAT_INC(comparisons);
         prev = temp;
         if (data < temp->data)
             temp = temp->left;
         else if (data > temp->data)
             temp = temp->right;
         else
+        {
+            *handle = temp;
             return DUPLICATE;  // Duplicate not allowed
+        }
     }
 
-    Tree *newNode = create_node(data);
-    if (newNode == NULL)
-        return FAILURE;
+    return attach_leaf(root, prev, prev && data > prev->data, data, handle, pool);
+}
 
-    if (*root == NULL)
+/* --------------------------------------------------------------------
+ * Function: insert_hint()
+ * Description: Like insert_handle(), but first tries the slot next to
+ *              @hint (typically the handle of the previous insert).
+ *              If @data falls between @hint and its in-order neighbour
+ *              it is linked there without a descent from the root, at
+ *              amortized O(1) fixup. With RB_THREADED the neighbour is
+ *              one link away, so ascending or descending runs are O(1);
+ *              otherwise finding it may climb the hint's spine, which
+ *              for an appended maximum is the whole right spine
+ *              (callers that know the hint is the extreme can use
+ *              attach_leaf() instead). A NULL or distant hint falls
+ *              back to a full insert_handle().
+ * --------------------------------------------------------------------*/
+int insert_hint(Tree **root, Tree *hint, int data, Tree **handle)
+{
+    return insert_hint_pool(root, hint, data, handle, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: insert_hint_pool()
+ * Description: Same as insert_hint(), allocating from @pool.
+ * --------------------------------------------------------------------*/
+int insert_hint_pool(Tree **root, Tree *hint, int data, Tree **handle, NodePool *pool)
+{
+    if (hint == NULL || data == hint->data)
+        return insert_handle_pool(root, data, handle, pool);
+
+    int dir = data > hint->data;   // side of @hint that @data belongs on
+    Tree *next, *slot = hint;
+
+    // Nearest neighbour of @hint on side @dir
+#ifdef RB_THREADED
+    next = dir ? hint->next : hint->prev;
+    if ((dir ? hint->right : hint->left) != NULL)
+        slot = next;   // bottom of that subtree, so its inner slot is free
+#else
+    if ((dir ? hint->right : hint->left) != NULL)
     {
-        newNode->color = BLACK;
-        *root = newNode;
-        return SUCCESS;
+        next = dir ? hint->right : hint->left;
+        while ((dir ? next->left : next->right) != NULL)
+            next = dir ? next->left : next->right;
+        slot = next;   // its inner slot is free
     }
-
-    newNode->parent = prev;
-    if (data < prev->data)
-        prev->left = newNode;
     else
-        prev->right = newNode;
+    {
+        next = hint;
+        while (NODE_PARENT(next) && (dir ? NODE_PARENT(next)->right : NODE_PARENT(next)->left) == next)
+            next = NODE_PARENT(next);
+        next = NODE_PARENT(next);
+    }
+#endif
 
-    // Fix Red-Black Tree violations
-    Tree *node = newNode, *uncle;
-    while (node != *root && node->parent->color == RED)
+    STAT_INC(comparisons);
+    if (next && (dir ? data >= next->data : data <= next->data))
+        return insert_handle_pool(root, data, handle, pool);
+
+    // @data lies strictly between @hint and @next
+    return attach_leaf(root, slot, slot == hint ? dir : !dir, data, handle, pool);
+}
+
+/* --------------------------------------------------------------------
+ * Function: insert_fixup()
+ * Description: Restores Red-Black properties after a new RED node
+ *              has been linked into the tree. Returns 1 if recoloring
+ *              reached the root, i.e. the black height grew by one.
+ * --------------------------------------------------------------------*/
+int insert_fixup(Tree **root, Tree *node)
+{
+    Tree *uncle;
+    while (node != *root && NODE_COLOR(NODE_PARENT(node)) == RED)
     {
-        if (node->parent == node->parent->parent->left)
+        STAT_INC(insert_fixups);
+        if (NODE_PARENT(node) == NODE_PARENT(NODE_PARENT(node))->left)
         {
-            uncle = node->parent->parent->right;
-            if (uncle && uncle->color == RED)
+            uncle = NODE_PARENT(NODE_PARENT(node))->right;
+            if (uncle && NODE_COLOR(uncle) == RED)
             {
                 // Case 1: Recoloring
-                uncle->color = BLACK;
-                node->parent->color = BLACK;
-                node->parent->parent->color = RED;
-                node = node->parent->parent;
+                STAT_INC(recolors);
+                SET_COLOR(uncle, BLACK);
+                SET_COLOR(NODE_PARENT(node), BLACK);
+                SET_COLOR(NODE_PARENT(NODE_PARENT(node)), RED);
+                node = NODE_PARENT(NODE_PARENT(node));
             }
             else
             {
                 // Case 2/3: Rotation
-                if (node == node->parent->right)
+                if (node == NODE_PARENT(node)->right)
                 {
-                    node = node->parent;
+                    node = NODE_PARENT(node);
                     left_rotate(root, node);
                 }
-                node->parent->color = BLACK;
-                node->parent->parent->color = RED;
-                right_rotate(root, node->parent->parent);
+                SET_COLOR(NODE_PARENT(node), BLACK);
+                SET_COLOR(NODE_PARENT(NODE_PARENT(node)), RED);
+                right_rotate(root, NODE_PARENT(NODE_PARENT(node)));
             }
         }
         else
         {
-            uncle = node->parent->parent->left;
-            if (uncle && uncle->color == RED)
+            uncle = NODE_PARENT(NODE_PARENT(node))->left;
+            if (uncle && NODE_COLOR(uncle) == RED)
             {
-                uncle->color = BLACK;
-                node->parent->color = BLACK;
-                node->parent->parent->color = RED;
-                node = node->parent->parent;
+                STAT_INC(recolors);
+                SET_COLOR(uncle, BLACK);
+                SET_COLOR(NODE_PARENT(node), BLACK);
+                SET_COLOR(NODE_PARENT(NODE_PARENT(node)), RED);
+                node = NODE_PARENT(NODE_PARENT(node));
             }
             else
             {
-                if (node == node->parent->left)
+                if (node == NODE_PARENT(node)->left)
                 {
-                    node = node->parent;
+                    node = NODE_PARENT(node);
                     right_rotate(root, node);
                 }
-                node->parent->color = BLACK;
-                node->parent->parent->color = RED;
-                left_rotate(root, node->parent->parent);
+                SET_COLOR(NODE_PARENT(node), BLACK);
+                SET_COLOR(NODE_PARENT(NODE_PARENT(node)), RED);
+                left_rotate(root, NODE_PARENT(NODE_PARENT(node)));
             }
         }
     }
-    (*root)->color = BLACK;
-    return SUCCESS;
+    int grew = NODE_COLOR(*root) == RED;
+    SET_COLOR(*root, BLACK);
+    return grew;
 }
 
 /* --------------------------------------------------------------------
@@ -211,11 +377,11 @@ Tree *findmin(Tree *root)
  * --------------------------------------------------------------------*/
 Tree *getsibling_node(Tree *node)
 {
-    if (node->parent == NULL)
+    if (NODE_PARENT(node) == NULL)
         return NULL;
-    return (node == node->parent->left)
-                ? node->parent->right
-                : node->parent->left;
+    return (node == NODE_PARENT(node)->left)
+                ? NODE_PARENT(node)->right
+                : NODE_PARENT(node)->left;
 }
 
 /* --------------------------------------------------------------------
@@ -224,84 +390,89 @@ Tree *getsibling_node(Tree *node)
  * --------------------------------------------------------------------*/
 int is_left_child(Tree *node)
 {
-    return (node->parent && node == node->parent->left);
+    return (NODE_PARENT(node) && node == NODE_PARENT(node)->left);
 }
 
 /* --------------------------------------------------------------------
  * Function: fix_double_black()
  * Description: Fixes Red-Black property violations caused by
- *              deleting a black node.
+ *              deleting a black node. Iterative: each pass either
+ *              resolves the double black or moves it up one level (a
+ *              RED sibling is rotated away first, and the same node
+ *              goes round again), so the stack use is constant.
  * --------------------------------------------------------------------*/
 void fix_double_black(Tree **root, Tree *node)
 {
-    if (node == *root)
-        return;
+    while (node != *root)
+    {
+        STAT_INC(double_black);
+        STAT_DEPTH_STEP();
+        Tree *sibling = getsibling_node(node);
 
-    Tree *sibling = getsibling_node(node);
+        if (sibling == NULL)
+        {
+            node = NODE_PARENT(node);
+            continue;
+        }
 
-    if (sibling == NULL)
-    {
-        fix_double_black(root, node->parent);
-    }
-    else
-    {
-        if (sibling->color == RED)
+        if (NODE_COLOR(sibling) == RED)
         {
-            node->parent->color = RED;
-            sibling->color = BLACK;
+            SET_COLOR(NODE_PARENT(node), RED);
+            SET_COLOR(sibling, BLACK);
             if (is_left_child(sibling))
-                right_rotate(root, node->parent);
+                right_rotate(root, NODE_PARENT(node));
             else
-                left_rotate(root, node->parent);
-            fix_double_black(root, node);
+                left_rotate(root, NODE_PARENT(node));
+            continue;
         }
-        else
+
+        if ((sibling->left && NODE_COLOR(sibling->left) == RED) ||
+            (sibling->right && NODE_COLOR(sibling->right) == RED))
         {
-            if ((sibling->left && sibling->left->color == RED) ||
-                (sibling->right && sibling->right->color == RED))
+            if (sibling->left && NODE_COLOR(sibling->left) == RED)
             {
-                if (sibling->left && sibling->left->color == RED)
+                if (is_left_child(sibling))
                 {
-                    if (is_left_child(sibling))
-                    {
-                        sibling->left->color = sibling->color;
-                        sibling->color = node->parent->color;
-                        right_rotate(root, node->parent);
-                    }
-                    else
-                    {
-                        sibling->left->color = node->parent->color;
-                        right_rotate(root, sibling);
-                        left_rotate(root, node->parent);
-                    }
+                    SET_COLOR(sibling->left, NODE_COLOR(sibling));
+                    SET_COLOR(sibling, NODE_COLOR(NODE_PARENT(node)));
+                    right_rotate(root, NODE_PARENT(node));
                 }
                 else
                 {
-                    if (is_left_child(sibling))
-                    {
-                        sibling->right->color = node->parent->color;
-                        left_rotate(root, sibling);
-                        right_rotate(root, node->parent);
-                    }
-                    else
-                    {
-                        sibling->right->color = sibling->color;
-                        sibling->color = node->parent->color;
-                        left_rotate(root, node->parent);
-                    }
+                    SET_COLOR(sibling->left, NODE_COLOR(NODE_PARENT(node)));
+                    right_rotate(root, sibling);
+                    left_rotate(root, NODE_PARENT(node));
                 }
-                node->parent->color = BLACK;
             }
             else
             {
-                sibling->color = RED;
-                if (node->parent->color == BLACK)
-                    fix_double_black(root, node->parent);
+                if (is_left_child(sibling))
+                {
+                    SET_COLOR(sibling->right, NODE_COLOR(NODE_PARENT(node)));
+                    left_rotate(root, sibling);
+                    right_rotate(root, NODE_PARENT(node));
+                }
                 else
-                    node->parent->color = BLACK;
+                {
+                    SET_COLOR(sibling->right, NODE_COLOR(sibling));
+                    SET_COLOR(sibling, NODE_COLOR(NODE_PARENT(node)));
+                    left_rotate(root, NODE_PARENT(node));
+                }
             }
+            SET_COLOR(NODE_PARENT(node), BLACK);
+            break;
         }
+
+        STAT_INC(recolors);
+        SET_COLOR(sibling, RED);
+        if (NODE_COLOR(NODE_PARENT(node)) == RED)
+        {
+            SET_COLOR(NODE_PARENT(node), BLACK);
+            break;
+        }
+        node = NODE_PARENT(node);
     }
+    STAT_DEPTH_DONE();
 }
 
 /* --------------------------------------------------------------------
@@ -310,6 +481,15 @@ void fix_double_black(Tree **root, Tree *node)
  *              Red-Black balance is restored.
  * --------------------------------------------------------------------*/
 int delete_node(Tree **root, int data)
+{
+    return delete_node_pool(root, data, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: delete_node_pool()
+ * Description: Same as delete_node(), returning the node to @pool.
+ * --------------------------------------------------------------------*/
+int delete_node_pool(Tree **root, int data, NodePool *pool)
 {
     if (*root == NULL)
         return FAILURE;
@@ -317,6 +497,7 @@ int delete_node(Tree **root, int data)
     Tree *temp = *root;
     while (temp)
     {
+        STAT_INC(comparisons);
         if (temp->data == data)
             break;
         else if (data < temp->data)
@@ -328,68 +509,246 @@ int delete_node(Tree **root, int data)
     if (temp == NULL)
         return DATA_NOT_FOUND;
 
-    Tree *to_delete = temp;
-    if (temp->left && temp->right)
+    return erase_handle_pool(root, temp, pool);
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: swap_with_successor()
+ * Description: Exchanges the tree positions (links, color and subtree
+ *              size) of @node and its in-order successor @succ, so that
+ *              @node can be unlinked from a slot with at most one
+ *              child. Keys stay in their nodes: no data is copied.
+ * --------------------------------------------------------------------*/
+static void swap_with_successor(Tree **root, Tree *node, Tree *succ)
+{
+    Tree *parent = NODE_PARENT(node), *succ_parent = NODE_PARENT(succ);
+    Tree *succ_right = succ->right;
+    int color = NODE_COLOR(node);
+
+    if (parent == NULL)
+        *root = succ;
+    else if (parent->left == node)
+        parent->left = succ;
+    else
+        parent->right = succ;
+    SET_PARENT(succ, parent);
+
+    succ->left = node->left;
+    SET_PARENT(succ->left, succ);
+    if (succ_parent == node)
+    {
+        succ->right = node;
+        SET_PARENT(node, succ);
+    }
+    else
     {
-        Tree *succ = findmin(temp->right);
-        temp->data = succ->data;
-        to_delete = succ;
+        succ->right = node->right;
+        SET_PARENT(succ->right, succ);
+        succ_parent->left = node;
+        SET_PARENT(node, succ_parent);
     }
 
+    node->left = NULL;
+    node->right = succ_right;
+    if (succ_right)
+        SET_PARENT(succ_right, node);
+
+    SET_COLOR(node, NODE_COLOR(succ));
+    SET_COLOR(succ, color);
+#ifdef RB_ORDER_STATS
+    unsigned int size = node->size;
+    node->size = succ->size;
+    succ->size = size;
+#endif
+}
+
+/* --------------------------------------------------------------------
+ * Function: erase_handle()
+ * Description: Removes @node, a handle into *root, without searching
+ *              for it. A node with two children trades places with its
+ *              successor first, so every other handle stays valid.
+ * --------------------------------------------------------------------*/
+int erase_handle(Tree **root, Tree *node)
+{
+    return erase_handle_pool(root, node, NULL);
+}
+
+/* --------------------------------------------------------------------
+ * Function: erase_handle_pool()
+ * Description: Same as erase_handle(), returning the node to @pool.
+ * --------------------------------------------------------------------*/
+int erase_handle_pool(Tree **root, Tree *node, NodePool *pool)
+{
+    if (*root == NULL || node == NULL)
+        return FAILURE;
+
+    if (node->left && node->right)
+        swap_with_successor(root, node, findmin(node->right));
+
+    Tree *to_delete = node;
     Tree *child = (to_delete->left) ? to_delete->left : to_delete->right;
-    int db = ((child == NULL || child->color == BLACK) && to_delete->color == BLACK);
+    int db = ((child == NULL || NODE_COLOR(child) == BLACK) && NODE_COLOR(to_delete) == BLACK);
+
+#ifdef RB_ORDER_STATS
+    // The victim counts as empty while any fixup rotations run
+    to_delete->size = 0;
+    SIZE_PATH_DEC(NODE_PARENT(to_delete));
+#endif
+
+    // A childless black node is fixed while still linked, so that
+    // its sibling can be found through its parent
+    if (db && child == NULL)
+        fix_double_black(root, to_delete);
 
     if (child)
-        child->parent = to_delete->parent;
+        SET_PARENT(child, NODE_PARENT(to_delete));
 
-    if (to_delete->parent == NULL)
+    if (NODE_PARENT(to_delete) == NULL)
         *root = child;
     else if (is_left_child(to_delete))
-        to_delete->parent->left = child;
+        NODE_PARENT(to_delete)->left = child;
     else
-        to_delete->parent->right = child;
+        NODE_PARENT(to_delete)->right = child;
 
-    if (db)
+    if (db && child)
+        fix_double_black(root, child);
+    else if (child)
     {
-        if (child)
-            fix_double_black(root, child);
-        else
-            fix_double_black(root, to_delete);
+        STAT_INC(recolors);
+        SET_COLOR(child, BLACK);
     }
-    else if (child)
-        child->color = BLACK;
 
-    free(to_delete);
+    THREAD_UNLINK(to_delete);
+    pool_free(pool, to_delete);
     return SUCCESS;
 }
 
 /* --------------------------------------------------------------------
  * Function: search_node()
- * Description: Searches for a node by value.
+ * Description: Searches for a node by value. A tombstone counts as
+ *              absent.
  * --------------------------------------------------------------------*/
 int search_node(Tree *root, int data)
 {
     while (root)
     {
+        STAT_INC(comparisons);
         if (root->data == data)
-            return SUCCESS;
+            return NODE_DEAD(root) ? DATA_NOT_FOUND : SUCCESS;
         root = (data < root->data) ? root->left : root->right;
     }
     return DATA_NOT_FOUND;
 }
 
+/* --------------------------------------------------------------------
+ * Function: search_many()
+ * Description: Looks up @n keys, writing SUCCESS or DATA_NOT_FOUND for
+ *              each into @results. Up to SEARCH_GROUP lookups advance
+ *              in lockstep, one level per round, and each prefetches
+ *              its next node, so the cache misses of different keys
+ *              overlap instead of being paid one after another.
+ * --------------------------------------------------------------------*/
+int search_many(Tree *root, const int *keys, size_t n, int *results)
+{
+    Tree *node[SEARCH_GROUP];
+    size_t index[SEARCH_GROUP];
+    size_t next = 0, active = 0;
+
+    if (n && (keys == NULL || results == NULL))
+        return FAILURE;
+
+    while (active < SEARCH_GROUP && next < n)
+    {
+        node[active] = root;
+        index[active++] = next++;
+    }
+
+    while (active)
+    {
+        for (size_t s = 0; s < active; )
+        {
+            Tree *cur = node[s];
+            int data = keys[index[s]];
+
+            if (cur)
+                STAT_INC(comparisons);
+            if (cur == NULL || cur->data == data)
+            {
+                results[index[s]] = (cur && !NODE_DEAD(cur)) ? SUCCESS : DATA_NOT_FOUND;
+
+                // Reuse the slot for the next key, or retire it
+                if (next < n)
+                {
+                    node[s] = root;
+                    index[s++] = next++;
+                }
+                else
+                {
+                    active--;
+                    node[s] = node[active];
+                    index[s] = index[active];
+                }
+                continue;
+            }
+
+            cur = (data < cur->data) ? cur->left : cur->right;
+            if (cur)
+                __builtin_prefetch(cur);
+            node[s++] = cur;
+        }
+    }
+    return SUCCESS;
+}
+
 /* --------------------------------------------------------------------
  * Function: delete_tree()
- * Description: Recursively frees all nodes in the tree.
+ * Description: Frees all nodes in the tree without recursion (see
+ *              delete_tree_pool()). Trees built on a NodePool are
+ *              released with pool_destroy() instead.
  * --------------------------------------------------------------------*/
 int delete_tree(Tree **root)
 {
-    if (*root == NULL)
-        return SUCCESS;
+    return delete_tree_pool(root, NULL);
+}
 
-    delete_tree(&((*root)->left));
-    delete_tree(&((*root)->right));
-    free(*root);
+/* --------------------------------------------------------------------
+ * Function: delete_tree_pool()
+ * Description: Same as delete_tree(), returning every node to @pool
+ *              one by one; use it for part of a pool's nodes.
+ *              Iterative: each node is released as soon as its child
+ *              links are read, in preorder, so every node is touched
+ *              once. For build_from_sorted() and load_tree() trees that
+ *              is also allocation order; a tree churned by inserts and
+ *              deletes is freed in no particular memory order.
+ *              Pending right subtrees wait on a fixed RB_MAX_HEIGHT
+ *              stack instead of the call stack. The stack is not bounds
+ *              checked: it relies on the tree being a valid Red-Black
+ *              Tree, whose height never exceeds RB_MAX_HEIGHT.
+ * --------------------------------------------------------------------*/
+int delete_tree_pool(Tree **root, NodePool *pool)
+{
+    Tree *pending[RB_MAX_HEIGHT];
+    Tree *node = *root;
+    int top = 0;
+
+    for (;;)
+    {
+        if (node == NULL)
+        {
+            if (top == 0)
+                break;
+            node = pending[--top];
+        }
+
+        Tree *left = node->left, *right = node->right;
+        pool_free(pool, node);
+        if (right)
+        {
+            __builtin_prefetch(right);
+            pending[top++] = right;
+        }
+        node = left;
+    }
     *root = NULL;
     return SUCCESS;
 }
@@ -408,22 +767,154 @@ void print_color(int color)
 
 /* --------------------------------------------------------------------
  * Function: print_tree()
- * Description: Recursively prints tree in a pretty format showing
- *              hierarchy and colors.
+ * Description: Prints tree in a pretty format showing hierarchy and
+ *              colors: a reverse in-order walk over parent links, so
+ *              the largest key comes first and depth sets the indent.
  * --------------------------------------------------------------------*/
 void print_tree(Tree *root, int space)
 {
-    if (root == NULL)
-        return;
+    Tree *node = root;
+    int depth = 1;
+
+    // Start at the rightmost node
+    while (node && node->right)
+    {
+        node = node->right;
+        depth++;
+    }
+
+    while (node)
+    {
+        printf("\n");
+        PRINT_SPACES(space + depth * SPACE_STEP);
+        printf("%d(", node->data);
+        print_color(NODE_COLOR(node));
+        printf(")\n");
+
+        if (node->left)
+        {
+            // Predecessor: rightmost node of the left subtree
+            node = node->left;
+            depth++;
+            while (node->right)
+            {
+                node = node->right;
+                depth++;
+            }
+        }
+        else
+        {
+            // Climb out of left subtrees, then one more step up
+            while (node != root && node == NODE_PARENT(node)->left)
+            {
+                node = NODE_PARENT(node);
+                depth--;
+            }
+            node = (node == root) ? NULL : NODE_PARENT(node);
+            depth--;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------
+ * Function: get_stats()
+ * Description: Copies the calling thread's counters into @stats.
+ *              Work done by set-operation worker threads is included:
+ *              set_op() merges each worker's counters after joining it.
+ *              Returns FAILURE (and zeroes @stats) without RB_STATS.
+ * --------------------------------------------------------------------*/
+int get_stats(RBStats *stats)
+{
+    if (stats == NULL)
+        return FAILURE;
+
+#ifdef RB_STATS
+    *stats = rb_stats;
+    return SUCCESS;
+#else
+    memset(stats, 0, sizeof(RBStats));
+    return FAILURE;
+#endif
+}
 
-    space += SPACE_STEP;
-    print_tree(root->right, space);
+/* --------------------------------------------------------------------
+ * Function: reset_stats()
+ * Description: Zeroes the calling thread's counters.
+ * --------------------------------------------------------------------*/
+void reset_stats(void)
+{
+#ifdef RB_STATS
+    memset(&rb_stats, 0, sizeof(RBStats));
+#endif
+}
 
-    printf("\n");
-    PRINT_SPACES(space);
-    printf("%d(", root->data);
-    print_color(root->color);
-    printf(")\n");
+#ifdef RB_ORDER_STATS
+/* --------------------------------------------------------------------
+ * Helper Function: count_less()
+ * Description: Counts keys below @data (or at most @data when
+ *              @inclusive is set) using the subtree sizes.
+ * --------------------------------------------------------------------*/
+static size_t count_less(Tree *root, int data, int inclusive)
+{
+    size_t count = 0;
 
-    print_tree(root->left, space);
+    while (root)
+    {
+        if (data < root->data || (data == root->data && !inclusive))
+            root = root->left;
+        else
+        {
+            count += NODE_SIZE(root->left) + 1;
+            root = root->right;
+        }
+    }
+    return count;
+}
+
+/* --------------------------------------------------------------------
+ * Function: rank_node()
+ * Description: Returns how many keys in the tree are smaller than @data.
+ * --------------------------------------------------------------------*/
+size_t rank_node(Tree *root, int data)
+{
+    return count_less(root, data, 0);
+}
+
+/* --------------------------------------------------------------------
+ * Function: select_node()
+ * Description: Stores the k-th smallest key (k starts at 0) in @data.
+ *              Returns DATA_NOT_FOUND if the tree has k keys or fewer.
+ * --------------------------------------------------------------------*/
+int select_node(Tree *root, size_t k, int *data)
+{
+    while (root)
+    {
+        size_t left = NODE_SIZE(root->left);
+
+        if (k < left)
+            root = root->left;
+        else if (k == left)
+        {
+            *data = root->data;
+            return SUCCESS;
+        }
+        else
+        {
+            k -= left + 1;
+            root = root->right;
+        }
+    }
+    return DATA_NOT_FOUND;
+}
+
+/* --------------------------------------------------------------------
+ * Function: count_range()
+ * Description: Returns how many keys lie within [lo, hi].
+ * --------------------------------------------------------------------*/
+size_t count_range(Tree *root, int lo, int hi)
+{
+    if (lo > hi)
+        return 0;
+    return count_less(root, hi, 1) - count_less(root, lo, 0);
 }
+#endif
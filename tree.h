@@ -16,10 +16,34 @@
  *                - insert_node()                  : Insert new data
  *                - delete_node()                  : Delete a specific node
  *                - delete_tree()                  : Free the entire tree
+ *                - insert_fixup()                 : Balance tree after insertion
  *                - fix_double_black()             : Balance tree after deletion
  *                - search_node()                  : Search for a data value
+ *                - search_many()                  : Interleaved, prefetching multi-key search
+ *                - findmin()                      : Leftmost node of a subtree
  *                - getsibling_node()              : Get sibling of a node
  *                - print_color() / print_tree()   : Display helpers
+ *                - pool_init() / pool_destroy()   : Slab node pool setup/teardown
+ *                - pool_alloc() / pool_free()     : Pool node allocation
+ *                - *_pool() variants              : Pool-backed node operations
+ *                - build_from_sorted()            : O(n) bulk build from sorted keys
+ *                - insert_batch()                 : Sorted, finger-guided batch insert
+ *                - insert_handle() / insert_hint(): Insert returning a stable node handle
+ *                - attach_leaf()                  : Insert into a known free slot, no search
+ *                - erase_handle()                 : Delete a node by handle, no search
+ *                - seek_node() / next_node() / prev_node(): In-order cursor steps
+ *                - visit_tree() / next_batch()    : Stackless in-order visitor / batch reads
+ *                - rbtree_*()                     : Tree handle with cached min/max
+ *                - rbtree_pop_min() / rbtree_pop_max(): Priority-queue dequeue
+ *                - rbtree_lazy_delete() / rbtree_purge(): Tombstone deletes (RB_LAZY_DELETE)
+ *                - *_topdown() variants           : Single-pass top-down insert/delete
+ *                - join_trees() / split_tree()    : Join around a key, split at a key
+ *                - union_trees() / intersect_trees() / subtract_trees()
+ *                                                 : Join-based parallel set operations
+ *                - extract_range() / delete_range(): Cut out all keys in [lo, hi]
+ *                - rank_node() / select_node()    : Order statistics (RB_ORDER_STATS)
+ *                - get_stats() / reset_stats()    : Hot-path counters (RB_STATS)
+ *                - count_range()                  : Keys within [lo, hi] (RB_ORDER_STATS)
  *
  *  Author      : Pankaj Kumar
  *  Roll No     : 25008_018
@@ -31,6 +55,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 /*--------------------------------------------------------------
  *                      STATUS MACROS
@@ -47,12 +72,131 @@
 #define SPACE_STEP 10          // number of spaces between tree levels
 #define PRINT_SPACES(n) for (int i = 0; i < n; i++) printf(" ");
 
+/*--------------------------------------------------------------
+ *                      SEARCH MACROS
+ *-------------------------------------------------------------*/
+#define SEARCH_GROUP 16        // lookups interleaved by search_many()
+
+/*--------------------------------------------------------------
+ *                      HEIGHT BOUND
+ *-------------------------------------------------------------*/
+#define RB_MAX_HEIGHT 64       // 2 * log2(n + 1) with n <= 2^32 int keys
+
+/*--------------------------------------------------------------
+ *                      SET OPERATION MACROS
+ *-------------------------------------------------------------*/
+#define SETOP_PAR_HEIGHT 12    // black height (>= 4095 nodes) worth a thread
+
 /*--------------------------------------------------------------
  *                      COLOR DEFINITIONS
  *-------------------------------------------------------------*/
 #define RED 0
 #define BLACK 1
 
+/*--------------------------------------------------------------
+ *                      ORDER STATISTICS
+ *  Build with -DRB_ORDER_STATS to keep a subtree size in every
+ *  node, enabling rank_node(), select_node() and count_range().
+ *-------------------------------------------------------------*/
+#ifdef RB_ORDER_STATS
+#define NODE_SIZE(n) ((n) ? (n)->size : 0)
+#define SIZE_UPDATE(n) ((n)->size = 1 + NODE_SIZE((n)->left) + NODE_SIZE((n)->right))
+#define SIZE_PATH_INC(n) for (Tree *p_ = (n); p_; p_ = NODE_PARENT(p_)) p_->size++;
+#define SIZE_PATH_DEC(n) for (Tree *p_ = (n); p_; p_ = NODE_PARENT(p_)) p_->size--;
+#else
+#define SIZE_UPDATE(n)
+#define SIZE_PATH_INC(n)
+#define SIZE_PATH_DEC(n)
+#endif
+
+/*--------------------------------------------------------------
+ *                      THREADED LINKS
+ *  Build with -DRB_THREADED to keep every node linked to its
+ *  in-order neighbours, making next_node()/prev_node() O(1).
+ *-------------------------------------------------------------*/
+#ifdef RB_THREADED
+#define THREAD_ATTACH(n, par, right) do {                                 \
+        Tree *p_ = (right) ? (par) : (par)->prev;                           \
+        Tree *s_ = (right) ? (par)->next : (par);                           \
+        (n)->prev = p_;                                                     \
+        (n)->next = s_;                                                     \
+        if (p_) p_->next = (n);                                             \
+        if (s_) s_->prev = (n);                                             \
+    } while (0)
+#define THREAD_UNLINK(n) do {                                             \
+        if ((n)->prev) (n)->prev->next = (n)->next;                         \
+        if ((n)->next) (n)->next->prev = (n)->prev;                         \
+    } while (0)
+#else
+#define THREAD_ATTACH(n, par, right) ((void)0)
+#define THREAD_UNLINK(n) ((void)0)
+#endif
+
+/*--------------------------------------------------------------
+ *                      LAZY DELETION
+ *  Build with -DRB_LAZY_DELETE to let an RBTree handle delete by
+ *  marking the node as a tombstone (see NODE_DEAD below). Once
+ *  more than max_dead_pct percent of its nodes are tombstones the
+ *  handle rebuilds the tree in one linear pass.
+ *
+ *  Tombstones are invisible to search_node(), search_many(), the
+ *  cursor and save_tree(). delete_node(), erase_handle(),
+ *  delete_node_topdown() and compaction keep each node's bit with
+ *  its key, so they are safe on a tree holding tombstones (though
+ *  on an RBTree's root they bypass its counts and cached min/max).
+ *  Everything else sees tombstones as members: the raw inserts
+ *  return DUPLICATE for a dead key without reviving it, and
+ *  split/join, the set operations, extract_range(), rank/select
+ *  and count_range() count or keep them. Call rbtree_purge()
+ *  before using any of those.
+ *-------------------------------------------------------------*/
+#define LAZY_MAX_DEAD_PCT 25   // default rebuild threshold
+
+/*--------------------------------------------------------------
+ *                      INSTRUMENTATION
+ *  Build with -DRB_STATS to count rotations, recolors, fixup work,
+ *  comparisons and allocations. Without it the STAT_* macros
+ *  expand to nothing and the hot paths are unchanged.
+ *-------------------------------------------------------------*/
+/**
+ * struct RBStats - Hot-path counters of the calling thread
+ * @left_rotations  : left_rotate() calls
+ * @right_rotations : right_rotate() calls
+ * @recolors        : Recolor-only fixup steps (insert case 1, delete
+ *                    sibling recolor, child blackening on delete)
+ * @insert_fixups   : insert_fixup() loop iterations
+ * @double_black    : fix_double_black() steps
+ * @double_black_max: Most fix_double_black() steps in one call
+ * @comparisons     : Nodes whose key was compared during a descent
+ * @node_allocs     : Nodes allocated (malloc or pool)
+ * @node_frees      : Nodes released (free or pool)
+ */
+typedef struct RBStats
+{
+    unsigned long left_rotations;
+    unsigned long right_rotations;
+    unsigned long recolors;
+    unsigned long insert_fixups;
+    unsigned long double_black;
+    unsigned long double_black_max;
+    unsigned long comparisons;
+    unsigned long node_allocs;
+    unsigned long node_frees;
+} RBStats;
+
+#ifdef RB_STATS
+extern _Thread_local RBStats rb_stats;
+extern _Thread_local unsigned long rb_stats_depth;
+#define STAT_INC(field) (rb_stats.field++)
+#define STAT_DEPTH_STEP() \
+    do { if (++rb_stats_depth > rb_stats.double_black_max) rb_stats.double_black_max = rb_stats_depth; } while (0)
+#define STAT_DEPTH_DONE() (rb_stats_depth = 0)
+#else
+#define STAT_INC(field) ((void)0)
+#define STAT_DEPTH_STEP() ((void)0)
+#define STAT_DEPTH_DONE() ((void)0)
+#endif
+
 /*--------------------------------------------------------------
  *                      STRUCTURE DEFINITION
  *-------------------------------------------------------------*/
@@ -63,14 +207,138 @@
  * @left   : Pointer to the left child
  * @right  : Pointer to the right child
  * @parent : Pointer to the parent node
+ * @size   : Number of nodes in this subtree (RB_ORDER_STATS only)
+ * @prev   : In-order predecessor (RB_THREADED only)
+ * @next   : In-order successor (RB_THREADED only)
+ *
+ * With -DRB_PACKED_COLOR the color lives in the low bit of the
+ * (always even) parent address, @parent_color. The 4 bytes saved
+ * let @data and @size share one word, so an order-statistic node
+ * stays at 32 bytes on 64-bit targets instead of 40.
+ *
+ * With -DRB_LAZY_DELETE a tombstone flag takes the next bit: bit 1
+ * of @parent_color, or of @color in the plain layout.
  */
 typedef struct Tree
 {
     int data;
+#ifdef RB_PACKED_COLOR
+#ifdef RB_ORDER_STATS
+    unsigned int size;
+#endif
+    struct Tree *left, *right;
+    uintptr_t parent_color;
+#else
     int color;
     struct Tree *left, *right, *parent;
+#ifdef RB_ORDER_STATS
+    unsigned int size;
+#endif
+#endif
+#ifdef RB_THREADED
+    struct Tree *prev, *next;
+#endif
 } Tree;
 
+/*--------------------------------------------------------------
+ *                      NODE ACCESSORS
+ *  All parent/color access goes through these, so the same code
+ *  works with the plain and the packed node layout.
+ *-------------------------------------------------------------*/
+#if defined(RB_PACKED_COLOR) && defined(RB_LAZY_DELETE)
+#define NODE_PARENT(n) ((Tree *)((n)->parent_color & ~(uintptr_t)3))
+#define NODE_COLOR(n) ((int)((n)->parent_color & 1))
+#define NODE_DEAD(n) ((int)((n)->parent_color >> 1) & 1)
+#define SET_PARENT(n, p) ((n)->parent_color = (uintptr_t)(p) | ((n)->parent_color & 3))
+#define SET_COLOR(n, c) ((n)->parent_color = ((n)->parent_color & ~(uintptr_t)1) | (uintptr_t)(c))
+#define SET_DEAD(n, d) ((n)->parent_color = ((n)->parent_color & ~(uintptr_t)2) | ((uintptr_t)(d) << 1))
+#elif defined(RB_PACKED_COLOR)
+#define NODE_PARENT(n) ((Tree *)((n)->parent_color & ~(uintptr_t)1))
+#define NODE_COLOR(n) ((int)((n)->parent_color & 1))
+#define NODE_DEAD(n) 0
+#define SET_PARENT(n, p) ((n)->parent_color = (uintptr_t)(p) | ((n)->parent_color & 1))
+#define SET_COLOR(n, c) ((n)->parent_color = ((n)->parent_color & ~(uintptr_t)1) | (uintptr_t)(c))
+#define SET_DEAD(n, d) ((void)0)
+#elif defined(RB_LAZY_DELETE)
+#define NODE_PARENT(n) ((n)->parent)
+#define NODE_COLOR(n) ((n)->color & 1)
+#define NODE_DEAD(n) (((n)->color >> 1) & 1)
+#define SET_PARENT(n, p) ((n)->parent = (p))
+#define SET_COLOR(n, c) ((n)->color = ((n)->color & 2) | (c))
+#define SET_DEAD(n, d) ((n)->color = ((n)->color & 1) | ((d) << 1))
+#else
+#define NODE_PARENT(n) ((n)->parent)
+#define NODE_COLOR(n) ((n)->color)
+#define NODE_DEAD(n) 0
+#define SET_PARENT(n, p) ((n)->parent = (p))
+#define SET_COLOR(n, c) ((n)->color = (c))
+#define SET_DEAD(n, d) ((void)0)
+#endif
+
+/*--------------------------------------------------------------
+ *                      NODE POOL
+ *-------------------------------------------------------------*/
+#define POOL_SLAB_NODES 4096   // default number of nodes per slab
+
+/**
+ * struct Slab - One contiguous block of tree nodes owned by a pool
+ * @next  : Previously allocated slab (slabs form a singly linked list)
+ * @nodes : Storage for the nodes handed out from this slab
+ */
+typedef struct Slab
+{
+    struct Slab *next;
+    Tree nodes[];
+} Slab;
+
+/**
+ * struct NodePool - Arena of fixed-size Tree slabs with a free list
+ * @slabs      : Most recently allocated slab (head of the slab list)
+ * @free_list  : Released nodes, chained through their @right pointer
+ * @slab_nodes : Number of nodes in every slab
+ * @slab_used  : Nodes already handed out from the head slab
+ */
+typedef struct NodePool
+{
+    Slab *slabs;
+    Tree *free_list;
+    size_t slab_nodes;
+    size_t slab_used;
+} NodePool;
+
+/*--------------------------------------------------------------
+ *                      TREE HANDLE
+ *-------------------------------------------------------------*/
+/**
+ * TreeVisitor - Callback of visit_tree(): gets each node and the
+ * caller's @arg, and returns SUCCESS to continue.
+ */
+typedef int (*TreeVisitor)(Tree *node, void *arg);
+
+/**
+ * struct RBTree - A tree with its extremes cached
+ * @root  : Root node
+ * @min   : Smallest node (NULL when empty)
+ * @max   : Largest node (NULL when empty)
+ * @count : Number of nodes (live ones, with RB_LAZY_DELETE)
+ * @pool  : Node source (NULL for malloc/free)
+ * @dead  : Number of tombstones (RB_LAZY_DELETE only)
+ * @max_dead_pct : Tombstone percentage that triggers rbtree_purge()
+ *
+ * With tombstones, @min and @max are the extreme live nodes.
+ */
+typedef struct RBTree
+{
+    Tree *root;
+    Tree *min, *max;
+    size_t count;
+    NodePool *pool;
+#ifdef RB_LAZY_DELETE
+    size_t dead;
+    unsigned int max_dead_pct;
+#endif
+} RBTree;
+
 /*--------------------------------------------------------------
  *                      FUNCTION DECLARATIONS
  *-------------------------------------------------------------*/
@@ -86,14 +354,96 @@ int delete_node(Tree **root, int data);
 int delete_tree(Tree **root);
 
 /* Tree balancing & fixing */
+int insert_fixup(Tree **root, Tree *node);
 void fix_double_black(Tree **root, Tree *node);
 
 /* Search utilities */
 int search_node(Tree *root, int data);
+int search_many(Tree *root, const int *keys, size_t n, int *results);
+Tree *findmin(Tree *root);
 Tree *getsibling_node(Tree *node);
 
 /* Display helpers */
 void print_color(int color);
 void print_tree(Tree *root, int space);
 
+/* Instrumentation (FAILURE when built without RB_STATS) */
+int get_stats(RBStats *stats);
+void reset_stats(void);
+
+/* Node pool (a NULL pool falls back to malloc/free) */
+int pool_init(NodePool *pool, size_t slab_nodes);
+int pool_destroy(NodePool *pool, Tree **root);
+Tree *pool_alloc(NodePool *pool);
+void pool_free(NodePool *pool, Tree *node);
+
+/* Pool-backed node operations */
+Tree *create_node_pool(int data, NodePool *pool);
+int insert_node_pool(Tree **root, int data, NodePool *pool);
+int delete_node_pool(Tree **root, int data, NodePool *pool);
+int delete_tree_pool(Tree **root, NodePool *pool);
+
+/* Node handles (nodes never change keys, so handles stay valid) */
+int insert_handle(Tree **root, int data, Tree **handle);
+int insert_handle_pool(Tree **root, int data, Tree **handle, NodePool *pool);
+int insert_hint(Tree **root, Tree *hint, int data, Tree **handle);
+int insert_hint_pool(Tree **root, Tree *hint, int data, Tree **handle, NodePool *pool);
+int attach_leaf(Tree **root, Tree *parent, int right, int data, Tree **handle, NodePool *pool);
+int erase_handle(Tree **root, Tree *node);
+int erase_handle_pool(Tree **root, Tree *node, NodePool *pool);
+
+/* In-order cursor (O(1) steps with RB_THREADED, amortized otherwise) */
+Tree *seek_node(Tree *root, int data);
+Tree *next_node(Tree *node);
+Tree *prev_node(Tree *node);
+int visit_tree(Tree *root, TreeVisitor visit, void *arg);
+size_t next_batch(Tree **cursor, int *keys, size_t max);
+#ifdef RB_THREADED
+void thread_tree(Tree *root);
+#endif
+
+/* Tree handle */
+int rbtree_init(RBTree *tree, NodePool *pool);
+int rbtree_insert(RBTree *tree, int data, Tree **handle);
+int rbtree_erase(RBTree *tree, Tree *node);
+int rbtree_delete(RBTree *tree, int data);
+int rbtree_destroy(RBTree *tree);
+int rbtree_peek_min(const RBTree *tree, int *data);
+int rbtree_peek_max(const RBTree *tree, int *data);
+int rbtree_pop_min(RBTree *tree, int *data);
+int rbtree_pop_max(RBTree *tree, int *data);
+#ifdef RB_LAZY_DELETE
+int rbtree_lazy_delete(RBTree *tree, int data);
+int rbtree_purge(RBTree *tree);
+#endif
+
+/* Single-pass top-down variants (no parent-link reads) */
+int insert_node_topdown(Tree **root, int data);
+int insert_node_topdown_pool(Tree **root, int data, NodePool *pool);
+int delete_node_topdown(Tree **root, int data);
+int delete_node_topdown_pool(Tree **root, int data, NodePool *pool);
+
+/* Bulk loading */
+Tree *build_from_sorted(const int *keys, size_t n);
+Tree *build_from_sorted_pool(const int *keys, size_t n, NodePool *pool);
+int insert_batch(Tree **root, int *keys, size_t n, int *status);
+int insert_batch_pool(Tree **root, int *keys, size_t n, int *status, NodePool *pool);
+
+/* Join, split and set operations (consume malloc-backed inputs) */
+int join_trees(Tree **root, Tree *left, int data, Tree *right);
+int split_tree(Tree **root, int data, Tree **left, Tree **right);
+Tree *union_trees(Tree *a, Tree *b);
+Tree *intersect_trees(Tree *a, Tree *b);
+Tree *subtract_trees(Tree *a, Tree *b);
+int extract_range(Tree **root, int lo, int hi, Tree **range);
+int delete_range(Tree **root, int lo, int hi);
+int delete_range_pool(Tree **root, int lo, int hi, NodePool *pool);
+
+#ifdef RB_ORDER_STATS
+/* Order statistics, O(log n) */
+size_t rank_node(Tree *root, int data);
+int select_node(Tree *root, size_t k, int *data);
+size_t count_range(Tree *root, int lo, int hi);
+#endif
+
 #endif /* TREE_H */
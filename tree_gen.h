@@ -0,0 +1,430 @@
+/***********************************************************************
+ *  File Name   : tree_gen.h
+ *  Description : Macro templates that generate a complete Red-Black
+ *                Tree for any key and value type.
+ *
+ *                RBTREE_GENERATE() instantiates the same algorithms as
+ *                tree.c (rotations, insertion fixup, deletion by
+ *                swapping with the successor and an iterative
+ *                double-black fixup, search and a stackless teardown)
+ *                for a chosen key type, value type and comparator.
+ *                Keys and values are stored inline in the node and the
+ *                comparator is expanded in place, so a lookup is only
+ *                pointer chasing: no function-pointer calls and no
+ *                payload indirection.
+ *
+ *  Usage:
+ *                #define STR_CMP(a, b) strcmp((a), (b))
+ *                RBTREE_PROTOTYPE(strmap, const char *, int)      // header
+ *                RBTREE_GENERATE(strmap, const char *, int, STR_CMP) // one .c
+ *
+ *                or, for a single translation unit:
+ *                RBTREE_PROTOTYPE_STATIC(imap, int, double)
+ *                RBTREE_GENERATE_STATIC(imap, int, double, RBTREE_INT_CMP)
+ *
+ *  Generated (for name "x"):
+ *                - x_node                      : Node type
+ *                - x_left_rotate() / x_right_rotate()
+ *                - x_insert_fixup() / x_fix_double_black()
+ *                - x_swap_with_successor()     : Relink instead of copying keys
+ *                - x_insert()                  : Insert key/value
+ *                - x_search()                  : Find node by key
+ *                - x_delete()                  : Delete by key; other nodes
+ *                                                never move, so x_search()
+ *                                                results stay valid
+ *                - x_destroy()                 : Free the entire tree
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef TREE_GEN_H
+#define TREE_GEN_H
+
+#include "tree.h"
+
+/*--------------------------------------------------------------
+ *                      COMPARATORS
+ *  A comparator is any expression-like macro (or inline function)
+ *  cmp(a, b) returning <0, 0 or >0, like strcmp().
+ *-------------------------------------------------------------*/
+#define RBTREE_INT_CMP(a, b) (((a) > (b)) - ((a) < (b)))
+
+/*--------------------------------------------------------------
+ *                      PROTOTYPES
+ *-------------------------------------------------------------*/
+#define RBTREE_PROTOTYPE(name, key_type, value_type) \
+    RBTREE_PROTOTYPE_INTERNAL(name, key_type, value_type, )
+#define RBTREE_PROTOTYPE_STATIC(name, key_type, value_type) \
+    RBTREE_PROTOTYPE_INTERNAL(name, key_type, value_type, static inline)
+
+#define RBTREE_PROTOTYPE_INTERNAL(name, key_type, value_type, attr)          \
+typedef struct name##_node                                                 \
+{                                                                          \
+    key_type key;                                                          \
+    value_type value;                                                      \
+    int color;                                                             \
+    struct name##_node *left, *right, *parent;                             \
+} name##_node;                                                             \
+                                                                           \
+attr void name##_left_rotate(name##_node **root, name##_node *node);       \
+attr void name##_right_rotate(name##_node **root, name##_node *node);      \
+attr void name##_insert_fixup(name##_node **root, name##_node *node);      \
+attr void name##_fix_double_black(name##_node **root, name##_node *node);  \
+attr void name##_swap_with_successor(name##_node **root, name##_node *node,\
+                                     name##_node *succ);                   \
+attr int name##_insert(name##_node **root, key_type key, value_type value);\
+attr name##_node *name##_search(name##_node *root, key_type key);          \
+attr int name##_delete(name##_node **root, key_type key);                  \
+attr int name##_destroy(name##_node **root);
+
+/*--------------------------------------------------------------
+ *                      IMPLEMENTATION
+ *-------------------------------------------------------------*/
+#define RBTREE_GENERATE(name, key_type, value_type, cmp) \
+    RBTREE_GENERATE_INTERNAL(name, key_type, value_type, cmp, )
+#define RBTREE_GENERATE_STATIC(name, key_type, value_type, cmp) \
+    RBTREE_GENERATE_INTERNAL(name, key_type, value_type, cmp, static inline)
+
+#define RBTREE_GENERATE_INTERNAL(name, key_type, value_type, cmp, attr)      \
+                                                                           \
+/* Performs a left rotation on a given node. */                            \
+attr void name##_left_rotate(name##_node **root, name##_node *node)        \
+{                                                                          \
+    name##_node *temp = node->right;                                       \
+    node->right = temp->left;                                              \
+    if (temp->left != NULL)                                                \
+        temp->left->parent = node;                                         \
+                                                                           \
+    temp->parent = node->parent;                                           \
+                                                                           \
+    if (node->parent == NULL)                                              \
+        *root = temp;                                                      \
+    else if (node == node->parent->left)                                   \
+        node->parent->left = temp;                                         \
+    else                                                                   \
+        node->parent->right = temp;                                        \
+                                                                           \
+    temp->left = node;                                                     \
+    node->parent = temp;                                                   \
+}                                                                          \
+                                                                           \
+/* Performs a right rotation on a given node. */                           \
+attr void name##_right_rotate(name##_node **root, name##_node *node)       \
+{                                                                          \
+    name##_node *temp = node->left;                                        \
+    node->left = temp->right;                                              \
+    if (temp->right != NULL)                                               \
+        temp->right->parent = node;                                        \
+                                                                           \
+    temp->parent = node->parent;                                           \
+                                                                           \
+    if (node->parent == NULL)                                              \
+        *root = temp;                                                      \
+    else if (node == node->parent->right)                                  \
+        node->parent->right = temp;                                        \
+    else                                                                   \
+        node->parent->left = temp;                                         \
+                                                                           \
+    temp->right = node;                                                    \
+    node->parent = temp;                                                   \
+}                                                                          \
+                                                                           \
+/* Restores Red-Black properties after linking a new RED leaf. */          \
+attr void name##_insert_fixup(name##_node **root, name##_node *node)       \
+{                                                                          \
+    name##_node *uncle;                                                    \
+    while (node != *root && node->parent->color == RED)                    \
+    {                                                                      \
+        name##_node *grand = node->parent->parent;                         \
+        if (node->parent == grand->left)                                   \
+        {                                                                  \
+            uncle = grand->right;                                          \
+            if (uncle && uncle->color == RED)                              \
+            {                                                              \
+                uncle->color = BLACK;                                      \
+                node->parent->color = BLACK;                               \
+                grand->color = RED;                                        \
+                node = grand;                                              \
+            }                                                              \
+            else                                                           \
+            {                                                              \
+                if (node == node->parent->right)                           \
+                {                                                          \
+                    node = node->parent;                                   \
+                    name##_left_rotate(root, node);                        \
+                }                                                          \
+                node->parent->color = BLACK;                               \
+                grand->color = RED;                                        \
+                name##_right_rotate(root, grand);                          \
+            }                                                              \
+        }                                                                  \
+        else                                                               \
+        {                                                                  \
+            uncle = grand->left;                                           \
+            if (uncle && uncle->color == RED)                              \
+            {                                                              \
+                uncle->color = BLACK;                                      \
+                node->parent->color = BLACK;                               \
+                grand->color = RED;                                        \
+                node = grand;                                              \
+            }                                                              \
+            else                                                           \
+            {                                                              \
+                if (node == node->parent->left)                            \
+                {                                                          \
+                    node = node->parent;                                   \
+                    name##_right_rotate(root, node);                       \
+                }                                                          \
+                node->parent->color = BLACK;                               \
+                grand->color = RED;                                        \
+                name##_left_rotate(root, grand);                           \
+            }                                                              \
+        }                                                                  \
+    }                                                                      \
+    (*root)->color = BLACK;                                                \
+}                                                                          \
+                                                                           \
+/* Inserts key/value; returns SUCCESS, DUPLICATE or FAILURE. */            \
+attr int name##_insert(name##_node **root, key_type key, value_type value) \
+{                                                                          \
+    name##_node *temp = *root, *prev = NULL;                               \
+    int diff = 0;                                                          \
+                                                                           \
+    while (temp)                                                           \
+    {                                                                      \
+        prev = temp;                                                       \
+        diff = cmp(key, temp->key);                                        \
+        if (diff < 0)                                                      \
+            temp = temp->left;                                             \
+        else if (diff > 0)                                                 \
+            temp = temp->right;                                            \
+        else                                                               \
+            return DUPLICATE;                                              \
+    }                                                                      \
+                                                                           \
+    name##_node *newNode = malloc(sizeof(name##_node));                    \
+    if (newNode == NULL)                                                   \
+        return FAILURE;                                                    \
+                                                                           \
+    newNode->key = key;                                                    \
+    newNode->value = value;                                                \
+    newNode->color = RED;                                                  \
+    newNode->left = newNode->right = NULL;                                 \
+    newNode->parent = prev;                                                \
+                                                                           \
+    if (prev == NULL)                                                      \
+        *root = newNode;                                                   \
+    else if (diff < 0)                                                     \
+        prev->left = newNode;                                              \
+    else                                                                   \
+        prev->right = newNode;                                             \
+                                                                           \
+    name##_insert_fixup(root, newNode);                                    \
+    return SUCCESS;                                                        \
+}                                                                          \
+                                                                           \
+/* Returns the node holding key, or NULL. */                               \
+attr name##_node *name##_search(name##_node *root, key_type key)           \
+{                                                                          \
+    while (root)                                                           \
+    {                                                                      \
+        int diff = cmp(key, root->key);                                    \
+        if (diff == 0)                                                     \
+            return root;                                                   \
+        root = (diff < 0) ? root->left : root->right;                      \
+    }                                                                      \
+    return NULL;                                                           \
+}                                                                          \
+                                                                           \
+/* Fixes Red-Black violations caused by removing a black node.            \
+ * Iterative, as in tree.c: each pass resolves the double black or        \
+ * moves it up one level, so the stack use is constant. */                \
+attr void name##_fix_double_black(name##_node **root, name##_node *node)   \
+{                                                                          \
+    while (node != *root)                                                  \
+    {                                                                      \
+        name##_node *parent = node->parent;                                \
+        name##_node *sibling = (node == parent->left) ? parent->right      \
+                                                      : parent->left;      \
+        if (sibling == NULL)                                               \
+        {                                                                  \
+            node = parent;                                                 \
+            continue;                                                      \
+        }                                                                  \
+                                                                           \
+        if (sibling->color == RED)                                         \
+        {                                                                  \
+            parent->color = RED;                                           \
+            sibling->color = BLACK;                                        \
+            if (sibling == parent->left)                                   \
+                name##_right_rotate(root, parent);                         \
+            else                                                           \
+                name##_left_rotate(root, parent);                          \
+            continue;                                                      \
+        }                                                                  \
+                                                                           \
+        if (sibling->left && sibling->left->color == RED)                  \
+        {                                                                  \
+            if (sibling == parent->left)                                   \
+            {                                                              \
+                sibling->left->color = sibling->color;                     \
+                sibling->color = parent->color;                            \
+                name##_right_rotate(root, parent);                         \
+            }                                                              \
+            else                                                           \
+            {                                                              \
+                sibling->left->color = parent->color;                      \
+                name##_right_rotate(root, sibling);                        \
+                name##_left_rotate(root, parent);                          \
+            }                                                              \
+            parent->color = BLACK;                                         \
+            break;                                                         \
+        }                                                                  \
+                                                                           \
+        if (sibling->right && sibling->right->color == RED)                \
+        {                                                                  \
+            if (sibling == parent->left)                                   \
+            {                                                              \
+                sibling->right->color = parent->color;                     \
+                name##_left_rotate(root, sibling);                         \
+                name##_right_rotate(root, parent);                         \
+            }                                                              \
+            else                                                           \
+            {                                                              \
+                sibling->right->color = sibling->color;                    \
+                sibling->color = parent->color;                            \
+                name##_left_rotate(root, parent);                          \
+            }                                                              \
+            parent->color = BLACK;                                         \
+            break;                                                         \
+        }                                                                  \
+                                                                           \
+        sibling->color = RED;                                              \
+        if (parent->color == RED)                                          \
+        {                                                                  \
+            parent->color = BLACK;                                         \
+            break;                                                         \
+        }                                                                  \
+        node = parent;                                                     \
+    }                                                                      \
+}                                                                          \
+                                                                           \
+/* Trades tree positions (links and color) of node and its successor      \
+ * succ, so node can be unlinked from a slot with at most one child.      \
+ * Keys and values stay in their nodes, so x_search() results held by     \
+ * the caller stay valid. */                                              \
+attr void name##_swap_with_successor(name##_node **root, name##_node *node,\
+                                     name##_node *succ)                    \
+{                                                                          \
+    name##_node *parent = node->parent, *succ_parent = succ->parent;       \
+    name##_node *succ_right = succ->right;                                 \
+    int color = node->color;                                               \
+                                                                           \
+    if (parent == NULL)                                                    \
+        *root = succ;                                                      \
+    else if (parent->left == node)                                         \
+        parent->left = succ;                                               \
+    else                                                                   \
+        parent->right = succ;                                              \
+    succ->parent = parent;                                                 \
+                                                                           \
+    succ->left = node->left;                                               \
+    succ->left->parent = succ;                                             \
+    if (succ_parent == node)                                               \
+    {                                                                      \
+        succ->right = node;                                                \
+        node->parent = succ;                                               \
+    }                                                                      \
+    else                                                                   \
+    {                                                                      \
+        succ->right = node->right;                                         \
+        succ->right->parent = succ;                                        \
+        succ_parent->left = node;                                          \
+        node->parent = succ_parent;                                        \
+    }                                                                      \
+                                                                           \
+    node->left = NULL;                                                     \
+    node->right = succ_right;                                              \
+    if (succ_right)                                                        \
+        succ_right->parent = node;                                         \
+                                                                           \
+    node->color = succ->color;                                             \
+    succ->color = color;                                                   \
+}                                                                          \
+                                                                           \
+/* Deletes key; returns SUCCESS, DATA_NOT_FOUND or FAILURE. */             \
+attr int name##_delete(name##_node **root, key_type key)                   \
+{                                                                          \
+    if (*root == NULL)                                                     \
+        return FAILURE;                                                    \
+                                                                           \
+    name##_node *to_delete = name##_search(*root, key);                    \
+    if (to_delete == NULL)                                                 \
+        return DATA_NOT_FOUND;                                             \
+                                                                           \
+    if (to_delete->left && to_delete->right)                               \
+    {                                                                      \
+        name##_node *succ = to_delete->right;                              \
+        while (succ->left)                                                 \
+            succ = succ->left;                                             \
+        name##_swap_with_successor(root, to_delete, succ);                 \
+    }                                                                      \
+                                                                           \
+    name##_node *child = to_delete->left ? to_delete->left                 \
+                                         : to_delete->right;               \
+    int db = ((child == NULL || child->color == BLACK) &&                  \
+              to_delete->color == BLACK);                                  \
+                                                                           \
+    if (db && child == NULL)                                               \
+        name##_fix_double_black(root, to_delete);                          \
+                                                                           \
+    if (child)                                                             \
+        child->parent = to_delete->parent;                                 \
+                                                                           \
+    if (to_delete->parent == NULL)                                         \
+        *root = child;                                                     \
+    else if (to_delete == to_delete->parent->left)                         \
+        to_delete->parent->left = child;                                   \
+    else                                                                   \
+        to_delete->parent->right = child;                                  \
+                                                                           \
+    if (db && child)                                                       \
+        name##_fix_double_black(root, child);                              \
+    else if (child)                                                        \
+        child->color = BLACK;                                              \
+                                                                           \
+    free(to_delete);                                                       \
+    return SUCCESS;                                                        \
+}                                                                          \
+                                                                           \
+/* Frees every node of the tree in preorder, as delete_tree_pool()        \
+ * does: pending right subtrees wait on a fixed RB_MAX_HEIGHT stack,      \
+ * which a valid Red-Black height never overflows. */                     \
+attr int name##_destroy(name##_node **root)                                \
+{                                                                          \
+    name##_node *pending[RB_MAX_HEIGHT];                                   \
+    name##_node *node = *root;                                             \
+    int top = 0;                                                           \
+                                                                           \
+    for (;;)                                                               \
+    {                                                                      \
+        if (node == NULL)                                                  \
+        {                                                                  \
+            if (top == 0)                                                  \
+                break;                                                     \
+            node = pending[--top];                                         \
+        }                                                                  \
+                                                                           \
+        name##_node *left = node->left, *right = node->right;              \
+        free(node);                                                        \
+        if (right)                                                         \
+            pending[top++] = right;                                        \
+        node = left;                                                       \
+    }                                                                      \
+    *root = NULL;                                                          \
+    return SUCCESS;                                                        \
+}
+
+#endif /* TREE_GEN_H */
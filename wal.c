@@ -0,0 +1,612 @@
+/***********************************************************************
+ *  File Name   : wal.c
+ *  Description : Write-ahead logging with group commit for the
+ *                Red-Black Tree (format and overview in wal.h).
+ *                A mutation is applied to the tree and appended to the
+ *                pending buffer under one lock, so log order is the
+ *                order the tree saw. The caller then sleeps until the
+ *                flusher reports its record durable. The flusher swaps
+ *                the pending buffer out, writes and fdatasync()s it
+ *                without the lock, and wakes every caller it covered;
+ *                callers arriving meanwhile fill the next batch.
+ *
+ *                A checkpoint copies the tree under the lock, then
+ *                writes and fsyncs the copy to a temporary file without
+ *                it while updates and flushes go on. Once every record
+ *                in the copy is in the log, the file is renamed over the
+ *                old checkpoint and the log cut down to the records
+ *                logged since the copy. Replaying a log over a
+ *                checkpoint that already contains some of it leaves
+ *                every key as its last record says, so a crash between
+ *                rename and cut is harmless.
+ *
+ *  Functions:
+ *      - write_all()
+ *      - read_at()
+ *      - temp_path()
+ *      - sync_dir()
+ *      - rewrite_log()
+ *      - do_checkpoint()
+ *      - flusher_main()
+ *      - checkpointer_main()
+ *      - replay_log()
+ *      - log_mutation()
+ *      - wal_open()
+ *      - wal_insert()
+ *      - wal_delete()
+ *      - wal_search()
+ *      - wal_checkpoint()
+ *      - wal_close()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "store.h"
+#include "wal.h"
+
+/* --------------------------------------------------------------------
+ * Helper Function: write_all()
+ * Description: write()s all @len bytes, retrying short writes.
+ * --------------------------------------------------------------------*/
+static int write_all(int fd, const void *buf, size_t len)
+{
+    const char *p = buf;
+
+    while (len > 0)
+    {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return FAILURE;
+        p += n;
+        len -= (size_t)n;
+    }
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: read_at()
+ * Description: pread()s all @len bytes at @offset, retrying short reads.
+ * --------------------------------------------------------------------*/
+static int read_at(int fd, void *buf, size_t len, off_t offset)
+{
+    char *p = buf;
+
+    while (len > 0)
+    {
+        ssize_t n = pread(fd, p, len, offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return FAILURE;
+        p += n;
+        len -= (size_t)n;
+        offset += n;
+    }
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: temp_path()
+ * Description: Returns a malloc'd "@path.tmp", or NULL.
+ * --------------------------------------------------------------------*/
+static char *temp_path(const char *path)
+{
+    size_t len = strlen(path);
+    char *tmp = malloc(len + 5);
+
+    if (tmp)
+    {
+        memcpy(tmp, path, len);
+        memcpy(tmp + len, ".tmp", 5);
+    }
+    return tmp;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: sync_dir()
+ * Description: fsyncs the directory holding @path, making a file
+ *              creation or rename in it durable.
+ * --------------------------------------------------------------------*/
+static int sync_dir(const char *path)
+{
+    const char *slash = strrchr(path, '/');
+    char dir[4096] = ".";
+
+    if (slash == path)
+        strcpy(dir, "/");
+    else if (slash && (size_t)(slash - path) < sizeof(dir))
+    {
+        memcpy(dir, path, (size_t)(slash - path));
+        dir[slash - path] = '\0';
+    }
+
+    int fd = open(dir, O_RDONLY);
+    if (fd < 0)
+        return FAILURE;
+    int flag = (fsync(fd) == 0) ? SUCCESS : FAILURE;
+    close(fd);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: rewrite_log()
+ * Description: Drops all but the last @keep records of the log, once a
+ *              checkpoint holding the rest is in place. Called with
+ *              @lock held and no flush in flight. With nothing to keep
+ *              the log is truncated in place; otherwise the tail goes
+ *              to a temporary log that is renamed over the old one, so
+ *              a crash leaves one log or the other, never a mix.
+ * --------------------------------------------------------------------*/
+static int rewrite_log(Wal *wal, size_t keep)
+{
+    WalFileHeader header = { { 'R', 'B', 'W', '1' }, WAL_BYTE_ORDER };
+
+    if (keep == 0)
+        return (ftruncate(wal->fd, sizeof(header)) == 0 && fsync(wal->fd) == 0) ? SUCCESS : FAILURE;
+
+    size_t bytes = keep * sizeof(WalRecord);
+    off_t from = (off_t)(sizeof(header) + (wal->since_checkpoint - keep) * sizeof(WalRecord));
+    WalRecord *tail = malloc(bytes);
+    char *tmp = temp_path(wal->log_path);
+    int fd = -1, flag = (tail && tmp) ? SUCCESS : FAILURE;
+
+    if (flag == SUCCESS)
+        flag = read_at(wal->fd, tail, bytes, from);
+    if (flag == SUCCESS && (fd = open(tmp, O_RDWR | O_CREAT | O_TRUNC | O_APPEND, 0644)) < 0)
+        flag = FAILURE;
+    if (flag == SUCCESS && (write_all(fd, &header, sizeof(header)) != SUCCESS ||
+                            write_all(fd, tail, bytes) != SUCCESS || fsync(fd) != 0))
+        flag = FAILURE;
+
+    if (flag == SUCCESS && rename(tmp, wal->log_path) == 0)
+    {
+        // From here on the new log is the log, whatever sync_dir() says
+        close(wal->fd);
+        wal->fd = fd;
+        flag = sync_dir(wal->log_path);
+    }
+    else
+    {
+        flag = FAILURE;
+        if (fd >= 0)
+        {
+            close(fd);
+            unlink(tmp);
+        }
+    }
+
+    free(tail);
+    free(tmp);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: do_checkpoint()
+ * Description: Saves the tree as the new checkpoint and drops the log
+ *              records it holds. Called with @lock held and
+ *              @checkpointing set; the lock is only kept to copy the
+ *              tree and to cut the log, so writers and the flusher run
+ *              on while the copy is written and synced. The copy may
+ *              include records not yet on disk, so it only replaces
+ *              the old checkpoint once the log holds them all.
+ * --------------------------------------------------------------------*/
+static int do_checkpoint(Wal *wal)
+{
+    uint64_t upto = wal->appended;
+    size_t count;
+    TreeRecord *records = snapshot_tree(wal->root, &count);
+    char *tmp = temp_path(wal->ckpt_path);
+    int flag = (records && tmp) ? SUCCESS : FAILURE;
+
+    pthread_mutex_unlock(&wal->lock);
+    if (flag == SUCCESS)
+        flag = save_records(records, count, tmp);
+    free(records);
+    if (flag == SUCCESS)
+    {
+        int fd = open(tmp, O_RDONLY);
+        if (fd < 0 || fsync(fd) != 0)
+            flag = FAILURE;
+        if (fd >= 0)
+            close(fd);
+    }
+    pthread_mutex_lock(&wal->lock);
+
+    while (flag == SUCCESS && wal->durable < upto && !wal->error)
+        pthread_cond_wait(&wal->done, &wal->lock);
+    if (wal->error)
+        flag = FAILURE;
+
+    if (flag == SUCCESS)
+    {
+        pthread_mutex_unlock(&wal->lock);
+        if (rename(tmp, wal->ckpt_path) != 0 || sync_dir(wal->ckpt_path) != SUCCESS)
+            flag = FAILURE;
+        pthread_mutex_lock(&wal->lock);
+    }
+    else if (tmp)
+        unlink(tmp);
+    free(tmp);
+
+    // Records logged after the copy stay; the flusher must not append meanwhile
+    while (flag == SUCCESS && wal->in_flight)
+        pthread_cond_wait(&wal->done, &wal->lock);
+    if (flag == SUCCESS)
+    {
+        size_t keep = (size_t)(wal->durable - upto);
+        flag = rewrite_log(wal, keep);
+        if (flag == SUCCESS)
+            wal->since_checkpoint = keep;
+    }
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: flusher_main()
+ * Description: Flusher thread: writes each gathered batch with one
+ *              fdatasync(), and wakes the checkpointer once enough
+ *              records have been logged. Drains the last batch before
+ *              exiting.
+ * --------------------------------------------------------------------*/
+static void *flusher_main(void *arg)
+{
+    Wal *wal = arg;
+
+    pthread_mutex_lock(&wal->lock);
+    for (;;)
+    {
+        while (wal->count == 0 && !wal->stop)
+            pthread_cond_wait(&wal->work, &wal->lock);
+        if (wal->count == 0)
+            break;
+        if (wal->error)
+        {
+            // Nothing may land in the log after a batch that failed
+            wal->count = 0;
+            continue;
+        }
+
+        WalRecord *batch = wal->pending;
+        size_t n = wal->count;
+        uint64_t upto = wal->appended;
+
+        wal->pending = wal->flushing;
+        wal->flushing = batch;
+        wal->count = 0;
+        wal->in_flight = 1;
+        pthread_mutex_unlock(&wal->lock);
+
+        int flag = write_all(wal->fd, batch, n * sizeof(WalRecord));
+        if (flag == SUCCESS && fdatasync(wal->fd) != 0)
+            flag = FAILURE;
+
+        pthread_mutex_lock(&wal->lock);
+        wal->in_flight = 0;
+        if (flag == SUCCESS)
+        {
+            wal->durable = upto;
+            wal->since_checkpoint += n;
+            if (wal->checkpoint_every && wal->since_checkpoint >= wal->checkpoint_every)
+                pthread_cond_signal(&wal->ckpt_work);
+        }
+        else
+            wal->error = 1;
+        pthread_cond_broadcast(&wal->done);
+    }
+    pthread_mutex_unlock(&wal->lock);
+    return NULL;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: checkpointer_main()
+ * Description: Checkpointer thread: checkpoints whenever the flusher
+ *              finds checkpoint_every records in the log, so no writer
+ *              pays for it. A wakeup missed while busy is repeated by
+ *              the next flush.
+ * --------------------------------------------------------------------*/
+static void *checkpointer_main(void *arg)
+{
+    Wal *wal = arg;
+
+    pthread_mutex_lock(&wal->lock);
+    while (!wal->stop)
+    {
+        pthread_cond_wait(&wal->ckpt_work, &wal->lock);
+        if (wal->stop || wal->checkpointing || wal->error || wal->checkpoint_every == 0 ||
+            wal->since_checkpoint < wal->checkpoint_every)
+            continue;
+
+        wal->checkpointing = 1;
+        if (do_checkpoint(wal) != SUCCESS)
+            wal->error = 1;
+        wal->checkpointing = 0;
+        pthread_cond_broadcast(&wal->done);
+    }
+    pthread_mutex_unlock(&wal->lock);
+    return NULL;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: replay_log()
+ * Description: Applies the valid records of the open log to the tree
+ *              and cuts off anything after them. A missing or empty log
+ *              gets a fresh header. Returns FAILURE on I/O errors or a
+ *              file that is not a log.
+ * --------------------------------------------------------------------*/
+static int replay_log(Wal *wal)
+{
+    struct stat st;
+    WalFileHeader header = { { 'R', 'B', 'W', '1' }, WAL_BYTE_ORDER };
+
+    if (fstat(wal->fd, &st) != 0)
+        return FAILURE;
+
+    if ((size_t)st.st_size < sizeof(header))
+    {
+        // New log, or one that crashed before its header was written
+        if (ftruncate(wal->fd, 0) != 0 || write_all(wal->fd, &header, sizeof(header)) != SUCCESS ||
+            fsync(wal->fd) != 0 || sync_dir(wal->log_path) != SUCCESS)
+            return FAILURE;
+        return SUCCESS;
+    }
+
+    char *buf = malloc((size_t)st.st_size);
+    if (buf == NULL)
+        return FAILURE;
+    if (read_at(wal->fd, buf, (size_t)st.st_size, 0) != SUCCESS)
+    {
+        free(buf);
+        return FAILURE;
+    }
+
+    const WalFileHeader *file = (const WalFileHeader *)buf;
+    if (memcmp(file->magic, WAL_MAGIC, 4) != 0 || file->byte_order != WAL_BYTE_ORDER)
+    {
+        free(buf);
+        return FAILURE;
+    }
+
+    const WalRecord *rec = (const WalRecord *)(file + 1);
+    size_t total = ((size_t)st.st_size - sizeof(header)) / sizeof(WalRecord), i;
+    int flag = SUCCESS;
+
+    for (i = 0; i < total && flag == SUCCESS; i++)
+    {
+        if (rec[i].check != WAL_CHECK(rec[i].data, rec[i].op))
+            break;
+        if (rec[i].op == WAL_OP_INSERT)
+            flag = insert_node_pool(&wal->root, rec[i].data, wal->pool) == FAILURE ? FAILURE : SUCCESS;
+        else if (rec[i].op == WAL_OP_DELETE)
+            delete_node_pool(&wal->root, rec[i].data, wal->pool);
+        else
+            break;
+    }
+    free(buf);
+    if (flag != SUCCESS)
+        return FAILURE;
+
+    off_t end = (off_t)(sizeof(header) + i * sizeof(WalRecord));
+    if (end != st.st_size && (ftruncate(wal->fd, end) != 0 || fsync(wal->fd) != 0))
+        return FAILURE;
+    wal->since_checkpoint = i;
+    return SUCCESS;
+}
+
+/* --------------------------------------------------------------------
+ * Helper Function: log_mutation()
+ * Description: Applies @op to the tree, logs it if it changed the tree
+ *              and waits until that record is durable. Returns the
+ *              tree operation's status, or FAILURE on an I/O error.
+ *              The change is applied before it is durable, and other
+ *              callers may have built on it by then, so a failed flush
+ *              cannot be undone: it sets @error instead, after which
+ *              every call fails (see wal.h).
+ * --------------------------------------------------------------------*/
+static int log_mutation(Wal *wal, int op, int data)
+{
+    pthread_mutex_lock(&wal->lock);
+    if (wal->error)
+    {
+        pthread_mutex_unlock(&wal->lock);
+        return FAILURE;
+    }
+
+    // Grow both buffers first so a logged change can always be appended;
+    // the one being written can only be resized once its flush is over
+    while (wal->count == wal->capacity)
+    {
+        if (wal->in_flight && !wal->error)
+        {
+            pthread_cond_wait(&wal->done, &wal->lock);
+            continue;
+        }
+
+        size_t capacity = wal->capacity ? 2 * wal->capacity : 1024;
+        WalRecord *pending = realloc(wal->pending, capacity * sizeof(WalRecord));
+        if (pending)
+            wal->pending = pending;
+        WalRecord *flushing = pending ? realloc(wal->flushing, capacity * sizeof(WalRecord)) : NULL;
+        if (flushing == NULL || wal->error)
+        {
+            pthread_mutex_unlock(&wal->lock);
+            return FAILURE;
+        }
+        wal->flushing = flushing;
+        wal->capacity = capacity;
+    }
+
+    int flag = (op == WAL_OP_INSERT) ? insert_node_pool(&wal->root, data, wal->pool)
+                                     : delete_node_pool(&wal->root, data, wal->pool);
+    if (flag == SUCCESS)
+    {
+        WalRecord *rec = &wal->pending[wal->count++];
+        rec->data = data;
+        rec->op = (uint16_t)op;
+        rec->check = WAL_CHECK(data, op);
+
+        uint64_t seq = ++wal->appended;
+        pthread_cond_signal(&wal->work);
+        while (wal->durable < seq && !wal->error)
+            pthread_cond_wait(&wal->done, &wal->lock);
+        if (wal->durable < seq)
+            flag = FAILURE;
+    }
+    pthread_mutex_unlock(&wal->lock);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Function: wal_open()
+ * Description: Recovers the tree from @ckpt_path (if present) and the
+ *              records of @log_path (created if missing), then starts
+ *              the flusher. Nodes come from @pool (NULL for malloc).
+ * --------------------------------------------------------------------*/
+int wal_open(Wal *wal, const char *log_path, const char *ckpt_path, NodePool *pool)
+{
+    memset(wal, 0, sizeof(*wal));
+    wal->pool = pool;
+    wal->checkpoint_every = WAL_CHECKPOINT_RECORDS;
+    wal->log_path = strdup(log_path);
+    wal->ckpt_path = strdup(ckpt_path);
+    wal->fd = -1;
+
+    int flag = (wal->log_path && wal->ckpt_path) ? SUCCESS : FAILURE;
+    if (flag == SUCCESS && access(ckpt_path, F_OK) == 0)
+        flag = load_tree_pool(ckpt_path, &wal->root, pool);
+    if (flag == SUCCESS)
+    {
+        wal->fd = open(log_path, O_RDWR | O_CREAT | O_APPEND, 0644);
+        flag = (wal->fd >= 0) ? replay_log(wal) : FAILURE;
+    }
+
+    if (flag == SUCCESS)
+    {
+        pthread_mutex_init(&wal->lock, NULL);
+        pthread_cond_init(&wal->work, NULL);
+        pthread_cond_init(&wal->done, NULL);
+        pthread_cond_init(&wal->ckpt_work, NULL);
+        if (pthread_create(&wal->flusher, NULL, flusher_main, wal) == 0)
+        {
+            if (pthread_create(&wal->checkpointer, NULL, checkpointer_main, wal) == 0)
+                return SUCCESS;
+
+            pthread_mutex_lock(&wal->lock);
+            wal->stop = 1;
+            pthread_cond_signal(&wal->work);
+            pthread_mutex_unlock(&wal->lock);
+            pthread_join(wal->flusher, NULL);
+        }
+
+        pthread_cond_destroy(&wal->ckpt_work);
+        pthread_cond_destroy(&wal->done);
+        pthread_cond_destroy(&wal->work);
+        pthread_mutex_destroy(&wal->lock);
+    }
+
+    if (wal->fd >= 0)
+        close(wal->fd);
+    delete_tree_pool(&wal->root, pool);
+    free(wal->log_path);
+    free(wal->ckpt_path);
+    return FAILURE;
+}
+
+/* --------------------------------------------------------------------
+ * Function: wal_insert()
+ * Description: insert_node() that returns once the insert is durable.
+ *              Safe to call from many threads.
+ * --------------------------------------------------------------------*/
+int wal_insert(Wal *wal, int data)
+{
+    return log_mutation(wal, WAL_OP_INSERT, data);
+}
+
+/* --------------------------------------------------------------------
+ * Function: wal_delete()
+ * Description: delete_node() that returns once the delete is durable.
+ *              Safe to call from many threads.
+ * --------------------------------------------------------------------*/
+int wal_delete(Wal *wal, int data)
+{
+    return log_mutation(wal, WAL_OP_DELETE, data);
+}
+
+/* --------------------------------------------------------------------
+ * Function: wal_search()
+ * Description: search_node() under the log's lock. May see a change
+ *              whose caller is still waiting for it to become durable.
+ *              Returns FAILURE once @error is set, as the tree may then
+ *              hold changes the disk does not.
+ * --------------------------------------------------------------------*/
+int wal_search(Wal *wal, int data)
+{
+    pthread_mutex_lock(&wal->lock);
+    int flag = wal->error ? FAILURE : search_node(wal->root, data);
+    pthread_mutex_unlock(&wal->lock);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Function: wal_checkpoint()
+ * Description: Checkpoints now, after any checkpoint in progress.
+ *              Writers are only held up while the tree is copied and
+ *              while the log is cut.
+ * --------------------------------------------------------------------*/
+int wal_checkpoint(Wal *wal)
+{
+    pthread_mutex_lock(&wal->lock);
+    while (wal->checkpointing && !wal->error)
+        pthread_cond_wait(&wal->done, &wal->lock);
+
+    int flag = FAILURE;
+    if (!wal->error)
+    {
+        wal->checkpointing = 1;
+        flag = do_checkpoint(wal);
+        wal->checkpointing = 0;
+        if (flag != SUCCESS)
+            wal->error = 1;
+        pthread_cond_broadcast(&wal->done);
+    }
+    pthread_mutex_unlock(&wal->lock);
+    return flag;
+}
+
+/* --------------------------------------------------------------------
+ * Function: wal_close()
+ * Description: Lets a running checkpoint finish, flushes the last
+ *              batch, stops both threads, closes the log and frees the
+ *              tree. Returns FAILURE if any write
+ *              since wal_open() failed.
+ * --------------------------------------------------------------------*/
+int wal_close(Wal *wal)
+{
+    pthread_mutex_lock(&wal->lock);
+    wal->stop = 1;
+    pthread_cond_signal(&wal->work);
+    pthread_cond_signal(&wal->ckpt_work);
+    pthread_mutex_unlock(&wal->lock);
+    pthread_join(wal->checkpointer, NULL);
+    pthread_join(wal->flusher, NULL);
+
+    int flag = (close(wal->fd) == 0 && !wal->error) ? SUCCESS : FAILURE;
+    delete_tree_pool(&wal->root, wal->pool);
+    free(wal->pending);
+    free(wal->flushing);
+    free(wal->log_path);
+    free(wal->ckpt_path);
+    pthread_cond_destroy(&wal->ckpt_work);
+    pthread_cond_destroy(&wal->done);
+    pthread_cond_destroy(&wal->work);
+    pthread_mutex_destroy(&wal->lock);
+    return flag;
+}
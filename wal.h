@@ -0,0 +1,140 @@
+/***********************************************************************
+ *  File Name   : wal.h
+ *  Description : Header file for the write-ahead logged Red-Black Tree.
+ *                Every successful insert or delete is appended to a
+ *                log and returns only once the log is on disk. One
+ *                background flusher writes and fsyncs whatever records
+ *                have gathered since its last flush, so concurrent
+ *                callers share a single fsync (group commit). After
+ *                checkpoint_every logged records a background
+ *                checkpointer saves the tree in save_tree() format and
+ *                empties the log, bounding recovery to one load_tree()
+ *                plus a short replay.
+ *
+ *                A change is applied to the tree before its record is
+ *                durable. If a write, fsync or checkpoint fails, the
+ *                tree may hold changes the disk does not, so the Wal
+ *                becomes unusable: every later call returns FAILURE,
+ *                and wal_close() then wal_open() recover the durable
+ *                state.
+ *
+ *                Log layout (native byte order):
+ *                  WalFileHeader, then one 8-byte WalRecord per
+ *                  mutation. Replay stops at the first record whose
+ *                  check does not match (a torn or unwritten tail).
+ *
+ *  Functions:
+ *                - wal_open()       : Recover a tree and start logging
+ *                - wal_insert()     : Durable insert
+ *                - wal_delete()     : Durable delete
+ *                - wal_search()     : Lookup
+ *                - wal_checkpoint() : Save the tree and empty the log
+ *                - wal_close()      : Flush, stop and free the tree
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef WAL_H
+#define WAL_H
+
+#include <pthread.h>
+#include "tree.h"
+
+/*--------------------------------------------------------------
+ *                      LOG FORMAT MACROS
+ *-------------------------------------------------------------*/
+#define WAL_MAGIC "RBW1"
+#define WAL_BYTE_ORDER 0x01020304u
+#define WAL_CHECKPOINT_RECORDS (1u << 20)   // default checkpoint_every
+
+#define WAL_OP_INSERT 1
+#define WAL_OP_DELETE 2
+#define WAL_CHECK(data, op) ((uint16_t)((uint32_t)(data) ^ ((uint32_t)(data) >> 16) ^ (op) ^ 0xA55Au))
+
+/**
+ * struct WalFileHeader - Start of a log file
+ * @magic      : WAL_MAGIC
+ * @byte_order : WAL_BYTE_ORDER as written by the logging host
+ */
+typedef struct WalFileHeader
+{
+    char magic[4];
+    uint32_t byte_order;
+} WalFileHeader;
+
+/**
+ * struct WalRecord - One logged mutation
+ * @data  : Key inserted or deleted
+ * @op    : WAL_OP_INSERT or WAL_OP_DELETE
+ * @check : WAL_CHECK(data, op)
+ */
+typedef struct WalRecord
+{
+    int32_t data;
+    uint16_t op;
+    uint16_t check;
+} WalRecord;
+
+/**
+ * struct Wal - A tree together with its log and flusher
+ * @lock             : Guards every field below and the tree
+ * @work             : Signalled when records are waiting to be flushed
+ * @done             : Broadcast after each flush or checkpoint
+ * @ckpt_work        : Signalled when the log is due for a checkpoint
+ * @flusher          : Background flusher thread
+ * @checkpointer     : Background checkpoint thread
+ * @root             : The tree, as of every appended record
+ * @pool             : Node pool of the tree (NULL = malloc/free)
+ * @log_path         : Log file
+ * @ckpt_path        : Checkpoint file (a save_tree() image)
+ * @fd               : Open log, O_APPEND
+ * @pending          : Records appended but not yet handed to the flusher
+ * @flushing         : Records being written by the flusher
+ * @count            : Number of records in @pending
+ * @capacity         : Capacity of @pending and @flushing
+ * @appended         : Sequence number of the last appended record
+ * @durable          : Sequence number of the last record on disk
+ * @since_checkpoint : Records in the log file
+ * @checkpoint_every : Checkpoint threshold in records (0 = never)
+ * @in_flight        : Set while the flusher writes without @lock
+ * @checkpointing    : Set while a checkpoint runs (mostly without @lock)
+ * @stop             : Tells the flusher to drain and exit
+ * @error            : Set on an I/O error; every later call fails
+ */
+typedef struct Wal
+{
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    pthread_cond_t ckpt_work;
+    pthread_t flusher;
+    pthread_t checkpointer;
+    Tree *root;
+    NodePool *pool;
+    char *log_path;
+    char *ckpt_path;
+    int fd;
+    WalRecord *pending;
+    WalRecord *flushing;
+    size_t count;
+    size_t capacity;
+    uint64_t appended;
+    uint64_t durable;
+    size_t since_checkpoint;
+    size_t checkpoint_every;
+    int in_flight;
+    int checkpointing;
+    int stop;
+    int error;
+} Wal;
+
+int wal_open(Wal *wal, const char *log_path, const char *ckpt_path, NodePool *pool);
+int wal_insert(Wal *wal, int data);
+int wal_delete(Wal *wal, int data);
+int wal_search(Wal *wal, int data);
+int wal_checkpoint(Wal *wal);
+int wal_close(Wal *wal);
+
+#endif /* WAL_H */